@@ -0,0 +1,219 @@
+/**
+ * @file clsAccountKey.h
+ * @brief Declares the `clsAccountKey` class, an account number packed into one 64-bit integer.
+ *
+ * ## Overview
+ * Account numbers follow a short format — an optional one or two letter prefix followed by
+ * digits (e.g. `A101`). `clsAccountKey` packs such an account number into a 64-bit integer,
+ * so the key index, the transfer log records and sorting compare and hash a single integer
+ * instead of a string.
+ *
+ * ## Encoding
+ * ```
+ * bit  63      : 0 = packed, 1 = interned (see below)
+ * bits 58..62  : first prefix letter  (1..26 for A..Z, 0 if none)
+ * bits 53..57  : second prefix letter (1..26 for A..Z, 0 if none)
+ * bits 49..52  : number of digits (1..14), so leading zeros survive
+ * bits  0..48  : the digits as a number (< 10^14)
+ * ```
+ * Packed keys sort by prefix, then by digit count, then numerically (`A9` < `A10` < `B1`).
+ *
+ * ## Notable Implementation Details
+ * - **Lossless fallback** — an account number that does not fit the format (lower-case letters,
+ *   longer prefixes, symbols, more than 14 digits) is *interned*: it is stored once in a
+ *   process-wide table and the key holds its table index with bit 63 set. `toString()` always
+ *   returns the original text, and two keys are equal exactly when their account numbers are.
+ * - Interned keys order after packed ones; among themselves they order by their text.
+ * - Packing never takes a lock; interning does (the table is shared by all threads).
+ * - The table never shrinks, so only keys of stored records are interned (the constructor).
+ *   Lookups of typed or probed account numbers go through `findExisting()`, which packs or finds
+ *   an existing entry but never adds one: a number that is not in the table cannot match any key.
+ * - Interned indexes are only meaningful inside one process: never persist `getValue()`.
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+#include <functional>
+using namespace std;
+
+class clsAccountKey
+{
+private:
+    static constexpr uint64_t _internedFlag = 1ULL << 63;
+    static const int _maxDigits = 14;
+
+    struct stInternTable
+    {
+        mutex lock;
+        vector <string> vAccountNumbers;
+        unordered_map <string, uint64_t> mpIndexes;
+    };
+
+    uint64_t _value = 0;
+
+    static stInternTable & _internTable()
+    {
+        static stInternTable table;
+        return table;
+    }
+
+    static uint64_t _letterCode(char character)
+    {
+        return (character >= 'A' && character <= 'Z') ? uint64_t(character - 'A' + 1) : 0;
+    }
+
+    /**
+     * @return false if the account number does not follow the packed format.
+     */
+    static bool _tryPack(string_view accountNumber, uint64_t & packed)
+    {
+        size_t letters = 0;
+        while (letters < accountNumber.size() && _letterCode(accountNumber[letters]) != 0)
+            letters++;
+
+        size_t digits = accountNumber.size() - letters;
+        if (letters > 2 || digits == 0 || digits > _maxDigits)
+            return false;
+
+        uint64_t number = 0;
+        for (size_t i = letters; i < accountNumber.size(); i++)
+        {
+            if (accountNumber[i] < '0' || accountNumber[i] > '9')
+                return false;
+            number = number * 10 + uint64_t(accountNumber[i] - '0');
+        }
+
+        uint64_t firstLetter = letters > 0 ? _letterCode(accountNumber[0]) : 0;
+        uint64_t secondLetter = letters > 1 ? _letterCode(accountNumber[1]) : 0;
+
+        packed = (firstLetter << 58) | (secondLetter << 53) | (uint64_t(digits) << 49) | number;
+        return true;
+    }
+
+    static uint64_t _intern(string_view accountNumber)
+    {
+        stInternTable & table = _internTable();
+        lock_guard <mutex> guard(table.lock);
+
+        auto it = table.mpIndexes.find(string(accountNumber));
+        if (it != table.mpIndexes.end())
+            return it->second;
+
+        uint64_t value = _internedFlag | table.vAccountNumbers.size();
+        table.vAccountNumbers.push_back(string(accountNumber));
+        table.mpIndexes[table.vAccountNumbers.back()] = value;
+        return value;
+    }
+
+public:
+    clsAccountKey() = default;
+
+    explicit clsAccountKey(string_view accountNumber)
+    {
+        if (!_tryPack(accountNumber, _value))
+            _value = _intern(accountNumber);
+    }
+
+    /**
+     * @brief Makes the key of an account number without interning it.
+     *
+     * @return false if the account number neither packs nor is interned already, so no key made so
+     *         far (and no stored record) can have it.
+     */
+    static bool findExisting(string_view accountNumber, clsAccountKey & key)
+    {
+        if (_tryPack(accountNumber, key._value))
+            return true;
+
+        stInternTable & table = _internTable();
+        lock_guard <mutex> guard(table.lock);
+
+        auto it = table.mpIndexes.find(string(accountNumber));
+        if (it == table.mpIndexes.end())
+            return false;
+
+        key._value = it->second;
+        return true;
+    }
+
+    uint64_t getValue() const
+    {
+        return _value;
+    }
+
+    /**
+     * @brief Checks whether the account number is held in the key itself (true) or interned (false).
+     */
+    bool isPacked() const
+    {
+        return (_value & _internedFlag) == 0;
+    }
+
+    /**
+     * @brief Decodes the key back into the exact account number it was made from.
+     */
+    string toString() const
+    {
+        if (!isPacked())
+        {
+            stInternTable & table = _internTable();
+            lock_guard <mutex> guard(table.lock);
+            return table.vAccountNumbers[_value & ~_internedFlag];
+        }
+
+        string accountNumber;
+
+        uint64_t firstLetter = (_value >> 58) & 31, secondLetter = (_value >> 53) & 31;
+        if (firstLetter != 0) accountNumber += char('A' + firstLetter - 1);
+        if (secondLetter != 0) accountNumber += char('A' + secondLetter - 1);
+
+        string digits = to_string(_value & ((1ULL << 49) - 1));
+        size_t digitCount = (_value >> 49) & 15;
+
+        accountNumber.append(digitCount - digits.size(), '0');
+        return accountNumber + digits;
+    }
+
+    bool operator==(const clsAccountKey & other) const
+    {
+        return _value == other._value;
+    }
+
+    bool operator!=(const clsAccountKey & other) const
+    {
+        return _value != other._value;
+    }
+
+    bool operator<(const clsAccountKey & other) const
+    {
+        if (isPacked() || other.isPacked() || _value == other._value)
+            return _value < other._value;
+
+        return toString() < other.toString();
+    }
+};
+
+namespace std
+{
+    /**
+     * @brief Hashes an account key by mixing its 64 bits (a multiply and two shifts).
+     */
+    template <>
+    struct hash<clsAccountKey>
+    {
+        size_t operator()(const clsAccountKey & key) const
+        {
+            uint64_t value = key.getValue();
+
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDULL;
+            value ^= value >> 33;
+            return size_t(value);
+        }
+    };
+}
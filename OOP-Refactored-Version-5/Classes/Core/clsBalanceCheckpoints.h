@@ -0,0 +1,540 @@
+/**
+ * @file clsBalanceCheckpoints.h
+ * @brief Declares the `clsBalanceCheckpoints` class, which answers "what was the balance of an account on a date".
+ *
+ * ## Overview
+ * Every transfer log line records the balances of both accounts after the transfer, so the balance of
+ * an account at any moment is the one its last transfer up to that moment left. Finding that transfer
+ * means replaying the log from the start; the checkpoints bound the replay instead:
+ * - `refresh()` walks the log from the last checkpoint and, every `recordsPerCheckpoint` transfers,
+ *   saves the balance of every account seen so far, with the log offset and the time it was taken at;
+ * - `balanceAsOf()` and `balancesAsOf()` start from the last checkpoint taken at or before the asked
+ *   time and replay the log from there, never beyond the next checkpoint: at most one interval.
+ *
+ * Only transfers are in the log, so the answer is "the balance the last transfer up to that time
+ * left". `balanceAsOf()` therefore checks it (`enBalanceAsOfCheck`): the next transfer of the
+ * account must start from that balance, or, if there is none, the clients file must still hold it.
+ * When it does not, a deposit, withdrawal or interest posting moved the balance in between and the
+ * answer is reported as possibly stale, with the balance found instead.
+ *
+ * ## Data Storage Format
+ * The checkpoints live in `TransferCheckpointsFolder`, next to the transfer log:
+ * - `index.txt`, one line per checkpoint, oldest first:
+ *   ```
+ *   Number#//#LogOffset#//#Records#//#TimestampKey#//#Accounts
+ *   ```
+ *   `LogOffset` is where the transfers not covered by the checkpoint start, `Records` the number of
+ *   log lines before it, and `TimestampKey` the time of the last of them (`clsDate::timestampKey()`).
+ * - `checkpoint-<Number>.txt`, the balances of the checkpoint, ordered by account number:
+ *   ```
+ *   AccountNumber#//#Balance#//#LastOffset
+ *   ```
+ *   `LastOffset` is the log offset of the last transfer of the account before the checkpoint.
+ *
+ * ## Notable Implementation Details
+ * - The log is appended in time order, so the transfers up to a time never reach past the next
+ *   checkpoint taken after it.
+ * - A checkpoint file is written under a temporary name and renamed before its index line is
+ *   appended, so the index only lists complete checkpoints.
+ * - If the log is shorter than the last checkpoint offset (it was replaced or truncated), every
+ *   checkpoint is dropped and rebuilt from the start of the log.
+ * - Only transfers are in the log: an account that never took part in one has no balance here, and
+ *   deposits, withdrawals and interest postings after its last transfer are not reflected; they are
+ *   detected, not replayed. `balancesAsOf()` does not check its balances: its callers (the
+ *   statements) compare them with the transfers that follow themselves.
+ * - Finding the next transfer of an account costs a binary search over the later checkpoints (each
+ *   step reads one checkpoint file) and the replay of one more interval.
+ * - Everything runs on the calling thread (the log windows are still parsed on the shared pool),
+ *   so the checkpoints can be used before handing work to the pool.
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <charconv>
+#include <cstdint>
+#include <cmath>
+#include <filesystem>
+#include "clsBankClient.h"
+#include "clsEnums.h"
+#include "clsGlobal.h"
+#include "../Utils/clsDate.h"
+#include "../Utils/clsLogScanner.h"
+#include "../Utils/clsString.h"
+#include "../Utils/clsTracer.h"
+using namespace std;
+
+/**
+ * @struct stCheckpointInfo
+ * @brief One line of the checkpoint index.
+ */
+struct stCheckpointInfo
+{
+    size_t number = 0;
+    uint64_t logOffset = 0;
+    uint64_t records = 0;
+    int64_t timestampKey = 0;
+    size_t accounts = 0;
+};
+
+/**
+ * @struct stAccountBalance
+ * @brief The balance the transfer log leaves an account, and the offset of the transfer that left it.
+ */
+struct stAccountBalance
+{
+    string accountNumber;
+    double balance = 0;
+    uint64_t lastOffset = 0;
+};
+
+/**
+ * @struct stBalanceAsOf
+ * @brief The outcome of a `balanceAsOf()` query.
+ *
+ * `checkpoint` is the number of the checkpoint the replay started from (0 for the start of the log).
+ * `check` tells whether the balance is backed by what follows it: `nextBalance` is the balance the
+ * next transfer of the account started from (at `nextOffset`), or its balance in the clients file
+ * when `nextInStore` is set.
+ */
+struct stBalanceAsOf
+{
+    bool found = false;
+    double balance = 0;
+    uint64_t lastOffset = 0;
+    size_t checkpoint = 0;
+    size_t replayedRecords = 0;
+    long long milliseconds = 0;
+    enBalanceAsOfCheck check = enBalanceAsOfCheck::Unchecked;
+    double nextBalance = 0;
+    uint64_t nextOffset = 0;
+    bool nextInStore = false;
+};
+
+class clsBalanceCheckpoints
+{
+private:
+    /**
+     * @brief A transfer of the log, reduced to what moves the balances.
+     */
+    struct _stCheckpointTransfer
+    {
+        bool valid = false;
+        uint64_t offset = 0;
+        int64_t timestampKey = 0;
+        string sourceAccount, destinationAccount;
+        double amount = 0, sourceBalance = 0, destinationBalance = 0;
+    };
+
+    static string _indexFile()
+    {
+        return TransferCheckpointsFolder + "/index.txt";
+    }
+
+    static string _checkpointFile(size_t number)
+    {
+        return TransferCheckpointsFolder + "/checkpoint-" + to_string(number) + ".txt";
+    }
+
+    template <typename Number>
+    static Number _parseNumber(string_view s)
+    {
+        Number value = 0;
+        from_chars(s.data(), s.data() + s.size(), value);
+        return value;
+    }
+
+    static _stCheckpointTransfer _parseTransfer(const string& line, uint64_t offset)
+    {
+        _stCheckpointTransfer transfer;
+        transfer.offset = offset;
+
+        string_view arFields[7];
+        if (clsString::splitView(line, arFields, 7, "#//#") != 7) return transfer;
+
+        transfer.valid = true;
+        transfer.timestampKey = clsDate::timestampKey(arFields[0]);
+        transfer.sourceAccount.assign(arFields[1]);
+        transfer.destinationAccount.assign(arFields[2]);
+        transfer.amount = clsString::parseDouble(arFields[3]);
+        transfer.sourceBalance = clsString::parseDouble(arFields[4]);
+        transfer.destinationBalance = clsString::parseDouble(arFields[5]);
+
+        return transfer;
+    }
+
+    static void _apply(map <string, stAccountBalance> & mpBalances, const _stCheckpointTransfer & transfer)
+    {
+        mpBalances[transfer.sourceAccount] = {transfer.sourceAccount, transfer.sourceBalance, transfer.offset};
+        mpBalances[transfer.destinationAccount] = {transfer.destinationAccount, transfer.destinationBalance, transfer.offset};
+    }
+
+    static vector <stCheckpointInfo> _readIndex()
+    {
+        vector <stCheckpointInfo> vIndex;
+
+        fstream myFile;
+        myFile.open(_indexFile(), ios::in);
+        if (!myFile.is_open()) return vIndex;
+
+        string line;
+        while (getline(myFile, line))
+        {
+            string_view arFields[5];
+            if (clsString::splitView(line, arFields, 5, "#//#") != 5) continue;
+
+            vIndex.push_back({_parseNumber<size_t>(arFields[0]), _parseNumber<uint64_t>(arFields[1]), _parseNumber<uint64_t>(arFields[2]),
+                              _parseNumber<int64_t>(arFields[3]), _parseNumber<size_t>(arFields[4])});
+        }
+        myFile.close();
+
+        return vIndex;
+    }
+
+    /**
+     * @brief Calls `visit(stAccountBalance)` for every balance of a checkpoint, in account order, until it returns false.
+     */
+    template <typename Visitor>
+    static bool _readCheckpoint(size_t number, Visitor visit)
+    {
+        fstream myFile;
+        myFile.open(_checkpointFile(number), ios::in);
+        if (!myFile.is_open()) return false;
+
+        string line;
+        while (getline(myFile, line))
+        {
+            string_view arFields[3];
+            if (clsString::splitView(line, arFields, 3, "#//#") != 3) continue;
+
+            if (!visit(stAccountBalance{string(arFields[0]), clsString::parseDouble(arFields[1]), _parseNumber<uint64_t>(arFields[2])}))
+                break;
+        }
+        myFile.close();
+
+        return true;
+    }
+
+    static bool _writeCheckpoint(const stCheckpointInfo & info, const map <string, stAccountBalance> & mpBalances)
+    {
+        string fileName = _checkpointFile(info.number);
+        string tempFileName = fileName + ".tmp";
+
+        fstream myFile;
+        myFile.open(tempFileName, ios::out | ios::binary);
+        if (!myFile.is_open()) return false;
+
+        string block;
+        for (const auto & [accountNumber, accountBalance] : mpBalances)
+        {
+            block += accountNumber + "#//#";
+            clsString::appendFixed(block, accountBalance.balance);
+            block += "#//#" + to_string(accountBalance.lastOffset) + "\n";
+
+            if (block.size() > (1 << 20))
+            {
+                myFile.write(block.data(), block.size());
+                block.clear();
+            }
+        }
+        myFile.write(block.data(), block.size());
+        myFile.close();
+
+        error_code error;
+        if (myFile.fail() || (filesystem::rename(tempFileName, fileName, error), error))
+        {
+            filesystem::remove(tempFileName, error);
+            return false;
+        }
+
+        myFile.open(_indexFile(), ios::out | ios::app);
+        if (!myFile.is_open()) return false;
+
+        myFile << info.number << "#//#" << info.logOffset << "#//#" << info.records << "#//#" << info.timestampKey << "#//#" << info.accounts << "\n";
+        myFile.close();
+
+        return !myFile.fail();
+    }
+
+    /**
+     * @brief The index of the last checkpoint taken at or before `timestampKey`, -1 if there is none.
+     */
+    static long _checkpointBefore(const vector <stCheckpointInfo> & vIndex, int64_t timestampKey)
+    {
+        auto after = upper_bound(vIndex.begin(), vIndex.end(), timestampKey,
+                                 [](int64_t key, const stCheckpointInfo & info) { return key < info.timestampKey; });
+        return (long)(after - vIndex.begin()) - 1;
+    }
+
+    /**
+     * @brief The offset of the last transfer of an account before checkpoint `number`, 0 if it had none.
+     */
+    static uint64_t _lastOffsetAt(size_t number, const string& accountNumber)
+    {
+        uint64_t lastOffset = 0;
+        _readCheckpoint(number, [&](const stAccountBalance & accountBalance)
+        {
+            if (accountBalance.accountNumber == accountNumber) lastOffset = accountBalance.lastOffset;
+            return accountBalance.accountNumber < accountNumber;
+        });
+        return lastOffset;
+    }
+
+    /**
+     * @brief The position of the interval holding the first transfer of an account after the one at
+     *        `lastOffset`, searched from the checkpoints after `position`; the last interval if none of them has it.
+     */
+    static long _intervalOfNextTransfer(const vector <stCheckpointInfo> & vIndex, long position, const string& accountNumber, uint64_t lastOffset)
+    {
+        long first = position + 1, last = (long)vIndex.size();
+        while (first < last)
+        {
+            long middle = first + (last - first) / 2;
+            if (_lastOffsetAt(vIndex[middle].number, accountNumber) != lastOffset)
+                last = middle;
+            else
+                first = middle + 1;
+        }
+        return first - 1;
+    }
+
+    /**
+     * @brief The balance an account had just before `transfer`, which names it.
+     */
+    static double _balanceBefore(const _stCheckpointTransfer & transfer, const string& accountNumber)
+    {
+        return transfer.sourceAccount == accountNumber ? transfer.sourceBalance + transfer.amount
+                                                       : transfer.destinationBalance - transfer.amount;
+    }
+
+    /**
+     * @brief Replays the transfers up to `timestampKey` of the interval after checkpoint `position` (-1 for the start).
+     * @return The number of log lines read.
+     */
+    template <typename Visitor>
+    static size_t _replayInterval(const vector <stCheckpointInfo> & vIndex, long position, int64_t timestampKey, Visitor visit)
+    {
+        uint64_t startOffset = position < 0 ? 0 : vIndex[position].logOffset;
+        uint64_t endOffset = (size_t)(position + 1) < vIndex.size() ? vIndex[position + 1].logOffset : UINT64_MAX;
+
+        clsLogScanner::stScanStats stats = clsLogScanner::forEachInRange<_stCheckpointTransfer>(TransferLogsFile, startOffset, endOffset,
+            [](const string& line, uint64_t offset) { return _parseTransfer(line, offset); },
+            [&](_stCheckpointTransfer & transfer)
+            {
+                if (transfer.valid && transfer.timestampKey <= timestampKey)
+                    visit(transfer);
+            });
+
+        return stats.records;
+    }
+
+public:
+    static const size_t defaultRecordsPerCheckpoint = 100000;
+
+    /**
+     * @brief Whether two balances match: within a cent or two float roundings, whichever is larger
+     *        (the clients file stores balances as `float`).
+     */
+    static bool sameBalance(double a, double b)
+    {
+        return fabs(a - b) <= max(0.01, max(fabs(a), fabs(b)) * 2.4e-7);
+    }
+
+    /**
+     * @brief Takes the checkpoints the transfers appended since the last one call for.
+     *
+     * @param recordsPerCheckpoint The number of log lines between two checkpoints.
+     * @return false if a checkpoint could not be written.
+     */
+    static bool refresh(size_t recordsPerCheckpoint = defaultRecordsPerCheckpoint)
+    {
+        clsTraceSpan span("clsBalanceCheckpoints::refresh");
+
+        vector <stCheckpointInfo> vIndex = _readIndex();
+
+        error_code error;
+        uint64_t logBytes = filesystem::file_size(TransferLogsFile, error);
+        if (error) logBytes = 0;
+
+        if (!vIndex.empty() && (vIndex.back().logOffset > logBytes || !filesystem::exists(_checkpointFile(vIndex.back().number))))
+        {
+            filesystem::remove_all(TransferCheckpointsFolder, error);
+            vIndex.clear();
+        }
+
+        filesystem::create_directories(TransferCheckpointsFolder, error);
+        if (error) return false;
+
+        map <string, stAccountBalance> mpBalances;
+        stCheckpointInfo last;
+
+        if (!vIndex.empty())
+        {
+            last = vIndex.back();
+            _readCheckpoint(last.number, [&mpBalances](stAccountBalance accountBalance)
+            {
+                string accountNumber = accountBalance.accountNumber;
+                mpBalances.emplace(move(accountNumber), move(accountBalance));
+                return true;
+            });
+        }
+
+        size_t sinceCheckpoint = 0;
+        bool written = true;
+
+        clsLogScanner::forEachInRange<_stCheckpointTransfer>(TransferLogsFile, last.logOffset, UINT64_MAX,
+            [](const string& line, uint64_t offset) { return _parseTransfer(line, offset); },
+            [&](_stCheckpointTransfer & transfer)
+            {
+                if (sinceCheckpoint == recordsPerCheckpoint && written)
+                {
+                    last = {last.number + 1, transfer.offset, last.records, last.timestampKey, mpBalances.size()};
+                    written = _writeCheckpoint(last, mpBalances);
+                    sinceCheckpoint = 0;
+                }
+
+                sinceCheckpoint++;
+                last.records++;
+
+                if (!transfer.valid) return;
+
+                _apply(mpBalances, transfer);
+                last.timestampKey = max(last.timestampKey, transfer.timestampKey);
+            });
+
+        return written;
+    }
+
+    /**
+     * @brief Lists the checkpoints, oldest first.
+     */
+    static vector <stCheckpointInfo> getCheckpoints()
+    {
+        return _readIndex();
+    }
+
+    /**
+     * @brief The balance of an account after its last transfer up to `timestampKey` (`clsDate::timestampKey()`).
+     *
+     * The checkpoints are refreshed first. The balance is then checked against the next transfer of
+     * the account, or the clients file if there is none (see `stBalanceAsOf::check`).
+     */
+    static stBalanceAsOf balanceAsOf(const string& accountNumber, int64_t timestampKey)
+    {
+        clsTraceSpan span("clsBalanceCheckpoints::balanceAsOf");
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+        refresh();
+
+        stBalanceAsOf result;
+        vector <stCheckpointInfo> vIndex = _readIndex();
+        long position = _checkpointBefore(vIndex, timestampKey);
+
+        if (position >= 0)
+        {
+            result.checkpoint = vIndex[position].number;
+            _readCheckpoint(result.checkpoint, [&](const stAccountBalance & accountBalance)
+            {
+                if (accountBalance.accountNumber == accountNumber)
+                {
+                    result = {true, accountBalance.balance, accountBalance.lastOffset, result.checkpoint};
+                    return false;
+                }
+                return accountBalance.accountNumber < accountNumber;
+            });
+        }
+
+        _stCheckpointTransfer next;
+
+        result.replayedRecords = _replayInterval(vIndex, position, INT64_MAX, [&](const _stCheckpointTransfer & transfer)
+        {
+            if (transfer.sourceAccount != accountNumber && transfer.destinationAccount != accountNumber) return;
+
+            if (transfer.timestampKey > timestampKey)
+            {
+                if (!next.valid) next = transfer;
+                return;
+            }
+
+            if (transfer.sourceAccount == accountNumber)
+                result = {true, transfer.sourceBalance, transfer.offset, result.checkpoint};
+            else
+                result = {true, transfer.destinationBalance, transfer.offset, result.checkpoint};
+            next = _stCheckpointTransfer();
+        });
+
+        if (result.found && !next.valid)
+        {
+            long interval = _intervalOfNextTransfer(vIndex, position, accountNumber, result.lastOffset);
+            if (interval > position)
+            {
+                result.replayedRecords += _replayInterval(vIndex, interval, INT64_MAX, [&](const _stCheckpointTransfer & transfer)
+                {
+                    if (!next.valid && transfer.offset > result.lastOffset &&
+                        (transfer.sourceAccount == accountNumber || transfer.destinationAccount == accountNumber))
+                        next = transfer;
+                });
+            }
+        }
+
+        if (result.found && next.valid)
+        {
+            result.nextBalance = _balanceBefore(next, accountNumber);
+            result.nextOffset = next.offset;
+            result.check = sameBalance(result.balance, result.nextBalance) ? enBalanceAsOfCheck::Confirmed : enBalanceAsOfCheck::Changed;
+        }
+        else if (result.found)
+        {
+            const clsBankClient & client = clsBankClient::findClient(accountNumber);
+            if (!client.isEmpty())
+            {
+                result.nextBalance = client.getAccountBalance();
+                result.nextInStore = true;
+                result.check = sameBalance(result.balance, result.nextBalance) ? enBalanceAsOfCheck::Confirmed : enBalanceAsOfCheck::Changed;
+            }
+        }
+
+        result.milliseconds = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    /**
+     * @brief The balance of every account with a transfer up to `timestampKey`, ordered by account number.
+     *
+     * The checkpoints are refreshed first.
+     */
+    static vector <stAccountBalance> balancesAsOf(int64_t timestampKey)
+    {
+        clsTraceSpan span("clsBalanceCheckpoints::balancesAsOf");
+
+        refresh();
+
+        map <string, stAccountBalance> mpBalances;
+        vector <stCheckpointInfo> vIndex = _readIndex();
+        long position = _checkpointBefore(vIndex, timestampKey);
+
+        if (position >= 0)
+        {
+            _readCheckpoint(vIndex[position].number, [&mpBalances](stAccountBalance accountBalance)
+            {
+                string accountNumber = accountBalance.accountNumber;
+                mpBalances.emplace_hint(mpBalances.end(), move(accountNumber), move(accountBalance));
+                return true;
+            });
+        }
+
+        _replayInterval(vIndex, position, timestampKey, [&mpBalances](const _stCheckpointTransfer & transfer) { _apply(mpBalances, transfer); });
+
+        vector <stAccountBalance> vBalances;
+        vBalances.reserve(mpBalances.size());
+        for (auto & [accountNumber, accountBalance] : mpBalances)
+            vBalances.push_back(move(accountBalance));
+
+        return vBalances;
+    }
+};
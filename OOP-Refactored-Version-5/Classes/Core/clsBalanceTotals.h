@@ -0,0 +1,144 @@
+/**
+ * @file clsBalanceTotals.h
+ * @brief Declares the `clsBalanceTotals` class, the running bank-wide totals of the clients file.
+ *
+ * ## Overview
+ * `clsRepository<clsBankClient>` keeps one `clsBalanceTotals` up to date with every record it adds,
+ * replaces or removes (deposits, withdrawals, transfers, new and deleted clients all go through it),
+ * so the total balance, the client count and the number of clients per balance bucket are read
+ * in O(1) instead of being summed over the whole file.
+ *
+ * ## Balance Buckets
+ * | Bucket | Balances            |
+ * |--------|---------------------|
+ * | 0      | below 0             |
+ * | 1      | 0 to 999.99         |
+ * | 2      | 1,000 to 9,999.99   |
+ * | 3      | 10,000 to 99,999.99 |
+ * | 4      | 100,000 to 999,999  |
+ * | 5      | 1,000,000 and above |
+ *
+ * ## Notable Implementation Details
+ * - The total is kept in whole cents (`int64_t`): adding and removing the same balance always
+ *   cancels exactly, so the running totals never drift from a full recompute.
+ * - `writeTo()` / `readFrom()` (de)serialize the totals for the repository's `.totals` checkpoint file.
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cmath>
+using namespace std;
+
+class clsBalanceTotals
+{
+public:
+    static constexpr bool enabled = true;
+    static const int BucketCount = 6;
+
+private:
+    int64_t _totalCents = 0;
+    int64_t _clientCount = 0;
+    int64_t _arBucketCounts[BucketCount] = {};
+
+    static int64_t _toCents(double balance)
+    {
+        return (int64_t)llround(balance * 100);
+    }
+
+    static int _bucketOf(int64_t cents)
+    {
+        if (cents < 0) return 0;
+
+        int bucket = 1;
+        for (int64_t limit = 1000 * 100; bucket < BucketCount - 1 && cents >= limit; limit *= 10)
+            bucket++;
+        return bucket;
+    }
+
+public:
+    void add(double balance)
+    {
+        int64_t cents = _toCents(balance);
+
+        _totalCents += cents;
+        _clientCount++;
+        _arBucketCounts[_bucketOf(cents)]++;
+    }
+
+    void remove(double balance)
+    {
+        int64_t cents = _toCents(balance);
+
+        _totalCents -= cents;
+        _clientCount--;
+        _arBucketCounts[_bucketOf(cents)]--;
+    }
+
+    void reset()
+    {
+        *this = clsBalanceTotals();
+    }
+
+    double getTotalBalance() const
+    {
+        return _totalCents / 100.0;
+    }
+
+    int64_t getClientCount() const
+    {
+        return _clientCount;
+    }
+
+    int64_t getBucketCount(int bucket) const
+    {
+        return _arBucketCounts[bucket];
+    }
+
+    static string getBucketLabel(int bucket)
+    {
+        static const string arLabels[BucketCount] = {"Below 0", "0 - 999", "1K - 9,999", "10K - 99,999", "100K - 999,999", "1M and above"};
+        return arLabels[bucket];
+    }
+
+    bool operator==(const clsBalanceTotals & other) const
+    {
+        if (_totalCents != other._totalCents || _clientCount != other._clientCount) return false;
+
+        for (int bucket = 0; bucket < BucketCount; bucket++)
+        {
+            if (_arBucketCounts[bucket] != other._arBucketCounts[bucket]) return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const clsBalanceTotals & other) const
+    {
+        return !(*this == other);
+    }
+
+    void writeTo(ostream & out) const
+    {
+        out << _totalCents << ' ' << _clientCount;
+        for (int bucket = 0; bucket < BucketCount; bucket++)
+            out << ' ' << _arBucketCounts[bucket];
+        out << '\n';
+    }
+
+    /**
+     * @return false if the stream does not hold a complete set of totals.
+     */
+    bool readFrom(istream & in)
+    {
+        clsBalanceTotals totals;
+
+        in >> totals._totalCents >> totals._clientCount;
+        for (int bucket = 0; bucket < BucketCount; bucket++)
+            in >> totals._arBucketCounts[bucket];
+
+        if (!in) return false;
+
+        *this = totals;
+        return true;
+    }
+};
@@ -6,6 +6,8 @@
 #include "../Utils/clsString.h"
 #include "../Utils/clsInputValidation.h"
 #include "../Utils/clsUtil.h"
+#include "../Utils/clsMetrics.h"
+#include "../Utils/clsTracer.h"
 using namespace std;
 
 // ----- Private Methods -----
@@ -14,28 +16,16 @@ clsBankClient clsBankClient::_convertLineIntoClientObject(const string& line, st
     vector <string> vClientData;
     clsString::split(line, vClientData, separator);
 
+    // truncated keys would be written back truncated, and could collide: refuse the record instead.
+    if (!clsPinCode::fits(vClientData[4]) || !clsAccountNumber::fits(vClientData[5]))
+        throw length_error("Client record with an over-long PIN code or account number: " + line);
+
     return clsBankClient(enMode::UpdateMode, vClientData[0], vClientData[1], vClientData[2], vClientData[3], vClientData[4], vClientData[5], stod(vClientData[6]));
 }
 
 vector <clsBankClient> clsBankClient::_loadDataFileIntoVector(const string& fileName)
 {
-    vector <clsBankClient> vClients;
-
-    fstream myFile;
-    myFile.open(fileName, ios::in);
-
-    if (myFile.is_open())
-    {
-        string line;
-
-        while(getline(myFile, line))
-        {
-            clsBankClient client = _convertLineIntoClientObject(line, "#//#");
-            vClients.push_back(client);
-        }
-        myFile.close();
-    }
-    return vClients;
+    return clsRepository<clsBankClient>::open(fileName).getAll();
 }
 
 clsBankClient clsBankClient::_getEmptyClientObject()
@@ -50,36 +40,39 @@ clsBankClient clsBankClient::_getAddClientObject(const string& accountNumber)
 
 string clsBankClient::_returnClientData(const clsBankClient& clientData, string sep)
 {
-    string clientRecord = "";
-
-    clientRecord += clientData.getFirstName()  + sep;
-    clientRecord += clientData.getLastName() + sep;
-    clientRecord += clientData.getEmail()   + sep;
-    clientRecord += clientData.getPhone()   + sep;
-    clientRecord += clientData.getPinCode()   + sep;
-    clientRecord += clientData.getAccountNumber()   + sep;
-    clientRecord += to_string(clientData.getAccountBalance());
+    string clientRecord;
+    clientRecord.reserve(128);
+
+    // * appended field by field: bulk rewrites serialize millions of clients through here.
+    clientRecord += clientData.getFirstName();
+    clientRecord += sep;
+    clientRecord += clientData.getLastName();
+    clientRecord += sep;
+    clientRecord += clientData.getEmail();
+    clientRecord += sep;
+    clientRecord += clientData.getPhone();
+    clientRecord += sep;
+    clientRecord += clientData.getPinCode().str();
+    clientRecord += sep;
+    clientRecord += clientData.getAccountNumber().str();
+    clientRecord += sep;
+    clsString::appendFixed(clientRecord, clientData.getAccountBalance());
 
     return clientRecord;
 }
 
 void clsBankClient::_saveClientDataIntoFile(const string& fileName, const vector <clsBankClient> & vClients)
 {
-    fstream myFile;
+    clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(fileName);
 
-    myFile.open(fileName, ios::out);
+    repository.replaceAll(vClients);
+    repository.commit();
 
-    if (myFile.is_open())
+    // clients missing from the list were removed too: rebuild the search indexes on next use.
+    if (fileName == ClientsDataFile)
     {
-        for (const clsBankClient & C : vClients)
-        {
-            if (C.getDeleteSign() == false)
-            {
-                string dataLine = _returnClientData(C);
-                myFile << dataLine << endl;
-            }
-        }
-        myFile.close();
+        _nameIndexState().generation = 0;
+        _accountTreeState().generation = 0;
     }
 }
 
@@ -98,7 +91,7 @@ void clsBankClient::_setClientInfo(clsBankClient & client)
     client.setPhone(clsInputValidation::readString());
 
     cout << "Enter PIN Code? ";
-    client._pinCode = clsInputValidation::readString();
+    client._pinCode = clsInputValidation::readString(clsPinCode::capacity(), "PIN Code is too long, Enter at most " + to_string(clsPinCode::capacity()) + " characters: ");
 
     cout << "Enter Account Balance? ";
     client._accountBalance = clsInputValidation::readDblNumber("Invalid Number, Enter A valid Number: ");
@@ -106,9 +99,14 @@ void clsBankClient::_setClientInfo(clsBankClient & client)
 
 void clsBankClient::_changeClientRecord(const string& accountNumber, vector <clsBankClient> & vClients)
 {
+    // an account number longer than the capacity cannot be stored, so no client has it.
+    if (!clsAccountNumber::fits(accountNumber)) return;
+
+    const clsAccountNumber key(accountNumber);
+
     for (clsBankClient & client : vClients)
     {
-        if (client._accountNumber == accountNumber)
+        if (client._accountNumber == key)
         {
             _setClientInfo(client);
         }
@@ -132,8 +130,58 @@ void clsBankClient::_showClientBalance(const clsBankClient & clientData)
     cout << "| " << setw(12) << left << clientData.getAccountBalance();
 }
 
+clsBankClient::stNameIndexState & clsBankClient::_nameIndexState()
+{
+    static stNameIndexState state;
+    return state;
+}
+
+clsBankClient::stAccountTreeState & clsBankClient::_accountTreeState()
+{
+    static stAccountTreeState state;
+    return state;
+}
+
+const clsRadixTree & clsBankClient::_getAccountTree()
+{
+    stAccountTreeState & state = _accountTreeState();
+    clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(ClientsDataFile);
+
+    size_t generation = repository.getGeneration();
+    if (state.generation != generation)
+    {
+        state.tree.clear();
+
+        for (const clsBankClient & client : repository.getAll())
+            state.tree.insert(client._accountNumber);
+
+        state.generation = generation;
+    }
+    return state.tree;
+}
+
+void clsBankClient::_updateSearchIndexes(const string& fileName, const clsBankClient & client)
+{
+    // indexes that were never built are built from the file on first use.
+    if (fileName != ClientsDataFile) return;
+
+    stNameIndexState & nameIndex = _nameIndexState();
+    stAccountTreeState & accountTree = _accountTreeState();
+
+    if (client.getDeleteSign())
+    {
+        if (nameIndex.generation != 0) nameIndex.index.remove(client._accountNumber.str());
+        if (accountTree.generation != 0) accountTree.tree.erase(client._accountNumber);
+    }
+    else
+    {
+        if (nameIndex.generation != 0) nameIndex.index.update(client._accountNumber.str(), client.getFirstName(), client.getLastName());
+        if (accountTree.generation != 0) accountTree.tree.insert(client._accountNumber);
+    }
+}
+
 // ----- Public Methods -----
-clsBankClient::clsBankClient(enMode mode, string firstName, string lastName, string email, string phone, string pinCode, string accountNumber, float accountBalance) : clsPerson(firstName, lastName, email, phone)
+clsBankClient::clsBankClient(enMode mode, string firstName, string lastName, string email, string phone, string pinCode, string accountNumber, float accountBalance) : clsPerson(move(firstName), move(lastName), move(email), move(phone))
 {
     _mode = mode;
     _pinCode = pinCode;
@@ -166,7 +214,7 @@ void clsBankClient::print()
     cout << "- - - - - - - - - - - - - - - - - - -\n\n";
 }
 
-bool clsBankClient::isEmpty()
+bool clsBankClient::isEmpty() const
 {
     return (_mode == enMode::EmptyMode);
 }
@@ -176,24 +224,59 @@ vector <clsBankClient> clsBankClient::getListVectorFromFile(const string& fileNa
     return _loadDataFileIntoVector(fileName);
 }
 
-clsBankClient clsBankClient::findClient(const string& accountNumber)
+clsArenaVector <stClientView> clsBankClient::getClientViews(const string& fileName, clsArena & arena)
 {
-    vector <clsBankClient> vClients = _loadDataFileIntoVector(ClientsDataFile);
-    for (clsBankClient & client: vClients)
+    const vector <clsBankClient> & vClients = clsRepository<clsBankClient>::open(fileName).getAll();
+
+    clsArenaVector <stClientView> vViews {clsArenaAllocator<stClientView>(arena)};
+    vViews.reserve(vClients.size());
+
+    for (const clsBankClient & client : vClients)
     {
-        if (client.getAccountNumber() == accountNumber)
-        {
-            return client;
-        }
+        stClientView view;
+
+        view.accountNumber = arena.copyString(client._accountNumber);
+        view.pinCode = arena.copyString(client._pinCode);
+        view.firstName = arena.copyString(client.getFirstName());
+        view.lastName = arena.copyString(client.getLastName());
+        view.phone = arena.copyString(client.getPhone());
+        view.email = arena.copyString(client.getEmail());
+        view.accountBalance = client._accountBalance;
+
+        vViews.push_back(view);
     }
-    return _getEmptyClientObject();
+    return vViews;
+}
+
+vector <double> clsBankClient::getBalanceColumn(const string& fileName)
+{
+    const vector <clsBankClient> & vClients = clsRepository<clsBankClient>::open(fileName).getAll();
+
+    vector <double> vBalances(vClients.size());
+    for (size_t i = 0; i < vClients.size(); i++)
+        vBalances[i] = vClients[i]._accountBalance;
+
+    return vBalances;
+}
+
+const clsBankClient & clsBankClient::findClient(const string& accountNumber)
+{
+    static const clsBankClient emptyClient = _getEmptyClientObject();
+
+    const clsBankClient * client = clsRepository<clsBankClient>::open(ClientsDataFile).find(accountNumber);
+    return client != nullptr ? *client : emptyClient;
 }
 
 clsBankClient & clsBankClient::findClientRef(const string& accountNumber, vector <clsBankClient>& vClients)
 {
+    if (!clsAccountNumber::fits(accountNumber)) throw runtime_error("Client Not Found");
+
+    // one fixed-size memcmp per client instead of a length check plus a string compare.
+    const clsAccountNumber key(accountNumber);
+
     for (clsBankClient & client: vClients)
     {
-        if (client.getAccountNumber() == accountNumber)
+        if (client.getAccountNumber() == key)
         {
             return client;
         }
@@ -201,16 +284,45 @@ clsBankClient & clsBankClient::findClientRef(const string& accountNumber, vector
     throw runtime_error("Client Not Found");
 }
 
+vector <stNameMatch> clsBankClient::findClientsByName(const string& query, size_t maxResults)
+{
+    static clsMetrics::clsHistogram & searchLatency = clsMetrics::histogram("client.nameSearch");
+    clsMetrics::clsScopedTimer timer(searchLatency);
+    clsTraceSpan span("clsBankClient::findClientsByName");
+
+    stNameIndexState & state = _nameIndexState();
+    clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(ClientsDataFile);
+
+    size_t generation = repository.getGeneration();
+    if (state.generation != generation)
+    {
+        state.index.clear();
+
+        for (const clsBankClient & client : repository.getAll())
+            state.index.add(client._accountNumber.str(), client.getFirstName(), client.getLastName());
+
+        state.generation = generation;
+    }
+    return state.index.search(query, maxResults);
+}
+
+vector <string> clsBankClient::suggestAccountNumbers(const string& prefix, size_t limit, size_t * totalMatches)
+{
+    const clsRadixTree & tree = _getAccountTree();
+
+    if (totalMatches != nullptr)
+        *totalMatches = tree.countWithPrefix(prefix);
+
+    return tree.withPrefix(prefix, limit);
+}
+
 bool clsBankClient::isClientExist(const string& accountNumber)
 {
-    clsBankClient client = findClient(accountNumber);
-    return (!client.isEmpty());
+    return clsRepository<clsBankClient>::open(ClientsDataFile).exists(accountNumber);
 }
 
 void clsBankClient::updateInfo()
 {
-    vector <clsBankClient> vClients = _loadDataFileIntoVector(ClientsDataFile);
-
     this->print();
 
     char ans = clsUtil::confirm("Are You sure You want to update this account data (Y/N)? ");
@@ -225,17 +337,8 @@ void clsBankClient::updateInfo()
 
             _changeClientRecord(*this);
 
-            // * to update the vector and the file with the new client record
-            for (clsBankClient &client: vClients)
-            {
-                if (client.getAccountNumber() == this->getAccountNumber())
-                {
-                    client = *this;
-                    break;
-                }
-            }
-
-            _saveClientDataIntoFile(ClientsDataFile, vClients);
+            // * only the updated record is written to the file.
+            saveClientRecord(ClientsDataFile, *this);
 
             cout << "\nClient Updated Successfully." << endl;
         }
@@ -245,8 +348,6 @@ void clsBankClient::updateInfo()
 
 void clsBankClient::deleteInfo()
 {
-    vector <clsBankClient> vClients = _loadDataFileIntoVector(ClientsDataFile);
-
     if (!this->isEmpty())
     {
         this->print();
@@ -255,19 +356,10 @@ void clsBankClient::deleteInfo()
 
         if (tolower(ans) == 'y')
         {
-            _markClientDeleteSign(*this, vClients);
-
-            // * to delete the client from the vector and the file.
-            for (clsBankClient &client: vClients)
-            {
-                if (client.getAccountNumber() == this->getAccountNumber())
-                {
-                    client = *this;
-                    break;
-                }
-            }
+            setDeleteSign(true);
 
-            _saveClientDataIntoFile(ClientsDataFile, vClients);
+            // * only the deletion of this record is written to the file.
+            saveClientRecord(ClientsDataFile, *this);
             *this = _getEmptyClientObject();
             cout << "\nClient Deleted Successfully." << endl;
         }
@@ -277,43 +369,88 @@ void clsBankClient::deleteInfo()
 
 double clsBankClient::calculateTotalBalances()
 {
-    vector <clsBankClient> vClients = _loadDataFileIntoVector(ClientsDataFile);
+    return getTotals().getTotalBalance();
+}
 
-    double totalBalances;
-    for (clsBankClient & client: vClients)
+clsBalanceTotals clsBankClient::getTotals()
+{
+    return clsRepository<clsBankClient>::open(ClientsDataFile).getTotals();
+}
+
+bool clsBankClient::verifyTotals(clsBalanceTotals * recomputed)
+{
+    return clsRepository<clsBankClient>::open(ClientsDataFile).verifyTotals(recomputed);
+}
+
+void clsBankClient::_showBalanceBuckets(const clsBalanceTotals & totals)
+{
+    cout << "-----------------------------------------------------------" << endl;
+    cout << "| " << left << setw(20) << "Balance:";
+    cout << "| " << left << setw(12) << "Clients:" << endl;
+    cout << "-----------------------------------------------------------" << endl;
+
+    for (int bucket = 0; bucket < clsBalanceTotals::BucketCount; bucket++)
     {
-        totalBalances += client.getAccountBalance();
+        cout << "| " << left << setw(20) << clsBalanceTotals::getBucketLabel(bucket);
+        cout << "| " << left << setw(12) << totals.getBucketCount(bucket) << endl;
     }
-    return totalBalances;
+    cout << "-----------------------------------------------------------" << endl;
 }
 
 void clsBankClient::showTotalBalances()
 {
-    vector <clsBankClient> vClients = _loadDataFileIntoVector(ClientsDataFile);
+    // * the totals are kept up to date by the repository: nothing is summed here.
+    clsBalanceTotals totals = getTotals();
+    double totalBalances = totals.getTotalBalance();
 
     cout << "\n\n";
-    cout << "\t\t Clients List (" << vClients.size() << "):" << endl;
-    cout << "-----------------------------------------------------------" << endl;
-    cout << "| " << left << setw(17) << "Account Number:";
-    cout << "| " << left << setw(20) << "Client Name:";
-    cout << "| " << left << setw(12) << "Balance:" << endl;
-    cout << "-----------------------------------------------------------" << endl;
+    cout << "\t\t Balances Summary (" << totals.getClientCount() << " Clients):" << endl;
+    _showBalanceBuckets(totals);
 
-    if (vClients.size() == 0)
+    cout << "\nTotal Balances: " << totalBalances << endl;
+    cout << clsUtil::getNumberInLetterForm(to_string(totalBalances)) << endl;
+
+    char ans = clsUtil::confirm("\nShow the balance of every client (Y/N)? ");
+
+    if (tolower(ans) == 'y')
     {
-        cout << "\t\t\t\t\tNo Data Available in the System" << endl;
+        vector <clsBankClient> vClients = _loadDataFileIntoVector(ClientsDataFile);
+
+        cout << "\n\t\t Clients List (" << vClients.size() << "):" << endl;
+        cout << "-----------------------------------------------------------" << endl;
+        cout << "| " << left << setw(17) << "Account Number:";
+        cout << "| " << left << setw(20) << "Client Name:";
+        cout << "| " << left << setw(12) << "Balance:" << endl;
+        cout << "-----------------------------------------------------------" << endl;
+
+        if (vClients.size() == 0)
+        {
+            cout << "\t\t\t\t\tNo Data Available in the System" << endl;
+        }
+
+        for (clsBankClient & client : vClients)
+        {
+            _showClientBalance(client);
+            cout << endl;
+        }
+        cout << "-----------------------------------------------------------" << endl;
     }
 
-    for (clsBankClient & client : vClients)
+    ans = clsUtil::confirm("\nVerify the totals against a full recompute (Y/N)? ");
+
+    if (tolower(ans) == 'y')
     {
-        _showClientBalance(client);
-        cout << endl;
-    }
+        clsBalanceTotals recomputed;
 
-    cout << "-----------------------------------------------------------" << endl;
-    double totalBalances = calculateTotalBalances();
-    cout << "\nTotal Balances: " << totalBalances << endl;
-    cout << clsUtil::getNumberInLetterForm(to_string(totalBalances));
+        if (verifyTotals(&recomputed))
+            cout << "\nTotals Verified: they match a full recompute of " << recomputed.getClientCount() << " clients." << endl;
+        else
+        {
+            cout << "\nTotals Mismatch! A full recompute gives " << recomputed.getTotalBalance()
+                 << " over " << recomputed.getClientCount() << " clients:" << endl;
+            _showBalanceBuckets(recomputed);
+        }
+    }
 }
 
 void clsBankClient::updateAccBalance(double amount)
@@ -326,19 +463,81 @@ void clsBankClient::saveClientDataIntoFile(const string& fileName,const vector <
     _saveClientDataIntoFile(fileName, vClients);
 }
 
+void clsBankClient::saveClientRecord(const string& fileName, const clsBankClient& client)
+{
+    clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(fileName);
+
+    repository.save(client);
+    repository.commit();
+
+    _updateSearchIndexes(fileName, client);
+}
+
+bool clsBankClient::addClientRecord(const string& fileName, const clsBankClient& client)
+{
+    if (!clsRepository<clsBankClient>::open(fileName).append(client)) return false;
+
+    _updateSearchIndexes(fileName, client);
+    return true;
+}
+
+void clsBankClient::saveClientRecords(const string& fileName, const vector <clsBankClient>& vChangedClients)
+{
+    clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(fileName);
+
+    for (const clsBankClient & client : vChangedClients)
+    {
+        repository.save(client);
+    }
+    repository.commit();
+
+    for (const clsBankClient & client : vChangedClients)
+        _updateSearchIndexes(fileName, client);
+}
+
 string clsBankClient::readAccountNumber(enStatus status)
 {
+    string tooLongMessage = "Account Number is too long, Enter at most " + to_string(clsAccountNumber::capacity()) + " characters: ";
+
     cout << "Please Enter an Account Number: ";
-    string accountNumber = clsInputValidation::readString();
+    string accountNumber = clsInputValidation::readString(clsAccountNumber::capacity(), tooLongMessage);
 
     switch(status)
     {
         case enStatus::Exist:
         {
-            while(!clsBankClient::isClientExist(accountNumber))
+            // the typed text may be the first characters of an account number: a unique prefix is
+            // offered for confirmation, an ambiguous one lists its candidates (all from memory, no file is read).
+            const size_t maxSuggestions = 10;
+
+            while(!_getAccountTree().contains(accountNumber))
             {
-                cout << "Account Number not found, Please enter an existed one: ";
-                accountNumber = clsInputValidation::readString();
+                size_t totalMatches = 0;
+                vector <string> vSuggestions = suggestAccountNumbers(accountNumber, maxSuggestions, &totalMatches);
+
+                if (totalMatches == 1)
+                {
+                    // the account is about to be debited or credited: never pick it without the teller's consent.
+                    char ans = clsUtil::confirm("Did you mean Account Number [" + vSuggestions[0] + "] (Y/N)? ");
+                    if (tolower(ans) == 'y')
+                    {
+                        accountNumber = vSuggestions[0];
+                        break;
+                    }
+                    cout << "Please Enter an Account Number: ";
+                }
+                else if (totalMatches == 0 || accountNumber.empty())
+                    cout << "Account Number not found, Please enter an existed one: ";
+                else
+                {
+                    cout << totalMatches << " Account Numbers start with [" << accountNumber << "]: ";
+                    for (size_t i = 0; i < vSuggestions.size(); i++)
+                        cout << (i == 0 ? "" : ", ") << vSuggestions[i];
+                    if (totalMatches > vSuggestions.size())
+                        cout << " ... (" << totalMatches - vSuggestions.size() << " more)";
+                    cout << "\nPlease type more of the Account Number: ";
+                }
+                accountNumber = clsInputValidation::readString(clsAccountNumber::capacity(), tooLongMessage);
             }
             break;
         }
@@ -347,9 +546,20 @@ string clsBankClient::readAccountNumber(enStatus status)
             while(clsBankClient::isClientExist(accountNumber))
             {
                 cout << "Account Number found, Please enter a new one: ";
-                accountNumber = clsInputValidation::readString();
+                accountNumber = clsInputValidation::readString(clsAccountNumber::capacity(), tooLongMessage);
             }
         }
     }
     return accountNumber;
 }
+
+// ----- Repository Traits -----
+clsBankClient clsEntityTraits<clsBankClient>::fromLine(const string& line)
+{
+    return clsBankClient::_convertLineIntoClientObject(line, "#//#");
+}
+
+string clsEntityTraits<clsBankClient>::toLine(const clsBankClient & client)
+{
+    return clsBankClient::_returnClientData(client);
+}
@@ -40,10 +40,27 @@
  *
  * ## Notable Implementation Details
  * - Uses an internal `enMode` enum to track object state (Empty, Update, Add).
+ * - The account number and the PIN code are `clsFixedString`s stored inside the object; their getters
+ *   return const references, and comparing two of them is a single fixed-size `memcmp`. A record
+ *   whose PIN code or account number does not fit is refused on load (`length_error`), never truncated.
+ * - `findClient()` returns a const reference to the cached client, so finding and printing a client
+ *   copies nothing (`app --check-allocs` verifies it performs no heap allocation at all).
+ * - `findClientsByName()` ranks clients by name through a `clsNameSearchIndex` (trigrams plus sorted
+ *   prefixes), which every save through this class keeps up to date.
+ * - `suggestAccountNumbers()` enumerates account numbers by prefix from a `clsRadixTree` kept in sync
+ *   with adds and deletes; `readAccountNumber()` uses it to offer the completion of a unique prefix
+ *   (taken only once the user confirms it) and to list the candidates of an ambiguous one.
+ * - `getAccountKey()` packs the account number into a 64-bit `clsAccountKey`; the repository's key
+ *   index, the transfer log records and account-ordered sorting use it instead of the text.
  * - Deletion is handled via a `_deleteSign` flag; deleted clients are skipped when saving.
  * - All getters for immutable data members are `const` so they can be called on const objects.
  * - Most static functions work on collections (`vector<clsBankClient>`) representing all loaded clients.
- * - `calculateTotalBalances()` sums balances of all clients.
+ * - File access goes through `clsRepository<clsBankClient>`, which caches and indexes the records
+ *   by account number; `clsEntityTraits<clsBankClient>` tells it how to (de)serialize a client.
+ * - `calculateTotalBalances()` and `getTotals()` read the running `clsBalanceTotals` that the repository
+ *   adjusts on every add, delete, deposit, withdrawal and transfer; `verifyTotals()` recomputes them.
+ * - `getClientViews()` copies all clients into a `clsArena` (`stClientView`) for read-only screens,
+ *   so listing them costs a few block allocations instead of several per client.
  * - Account number input can be validated for uniqueness or existence using `readAccountNumber()`.
  *
  * @note This class is tightly coupled with file-based storage;
@@ -54,8 +71,31 @@
 #include <vector>
 #include "clsPerson.h"
 #include "clsEnums.h"
+#include "../Templates/clsRepository.h"
+#include "../Utils/clsArena.h"
+#include "../Utils/clsFixedString.h"
+#include "clsAccountKey.h"
+#include "clsBalanceTotals.h"
+#include "../Utils/clsNameSearchIndex.h"
+#include "../Utils/clsRadixTree.h"
 using namespace std;
 
+// account numbers and PIN codes are short and bounded: they are stored inline in the client.
+using clsAccountNumber = clsFixedString<31>;
+using clsPinCode = clsFixedString<15>;
+
+/**
+ * @struct stClientView
+ * @brief An arena-aware, read-only copy of a client for list screens and reports.
+ *
+ * The text fields view bytes owned by the `clsArena` passed to `clsBankClient::getClientViews()`.
+ */
+struct stClientView
+{
+    string_view accountNumber, pinCode, firstName, lastName, phone, email;
+    double accountBalance = 0;
+};
+
 /**
  * @class clsBankClient
  * @brief Represents a Client in the banking system.
@@ -71,8 +111,8 @@ class clsBankClient : public clsPerson
 private:
 
     enMode _mode;
-    string _pinCode;
-    string _accountNumber;
+    clsPinCode _pinCode;
+    clsAccountNumber _accountNumber;
     double  _accountBalance;
     bool   _deleteSign = false;
 
@@ -91,8 +131,8 @@ private:
     /**
      * @brief Load client data from a file into a vector of clsBankClient objects.
      *
-     * Opens the specified file, reads each line, converts it into a clsBankClient
-     * object using _convertLineIntoClientObject(), and stores it in a vector.
+     * Returns a copy of the records cached by the clients `clsRepository`; the file itself
+     * is only parsed again when it changed on disk.
      *
      * @param fileName The name of the file containing serialized client data.
      * @return A vector of clsBankClient objects loaded from the file.
@@ -132,8 +172,8 @@ private:
     /**
      * @brief Save client data from a vector into a file.
      *
-     * Writes serialized client data into the specified file, excluding clients
-     * marked with the delete sign.
+     * Hands the vector to the clients `clsRepository`, which drops the clients marked with
+     * the delete sign and rewrites the file only if a record actually changed.
      *
      * @param fileName The name of the file to write data into.
      * @param vClients The vector of clsBankClient objects to save.
@@ -191,6 +231,47 @@ private:
      */
     static void _showClientBalance(const clsBankClient & clientData);
 
+    /**
+     * @brief Display the number of clients in every balance bucket as a table.
+     */
+    static void _showBalanceBuckets(const clsBalanceTotals & totals);
+
+    /**
+     * @brief The name index of the clients data file and the repository generation it was built from (0: not built).
+     */
+    struct stNameIndexState
+    {
+        clsNameSearchIndex index;
+        size_t generation = 0;
+    };
+
+    static stNameIndexState & _nameIndexState();
+
+    /**
+     * @brief The account number tree of the clients data file and the repository generation it was built from (0: not built).
+     */
+    struct stAccountTreeState
+    {
+        clsRadixTree tree;
+        size_t generation = 0;
+    };
+
+    static stAccountTreeState & _accountTreeState();
+
+    /**
+     * @brief Returns the account number tree, (re)building it if the clients file was (re)loaded.
+     */
+    static const clsRadixTree & _getAccountTree();
+
+    /**
+     * @brief Applies a saved client (added, renamed or deleted) to the name index and the account
+     *        number tree, for each one that is built.
+     *
+     * @param fileName The data file the client was saved to; only `ClientsDataFile` is indexed.
+     * @param client The client as saved.
+     */
+    static void _updateSearchIndexes(const string& fileName, const clsBankClient & client);
+
 public:
     /**
      * @brief Constructs a new clsBankClient object with specified personal and account details.
@@ -242,13 +323,21 @@ public:
     /**
      * @brief Retrieves the client's account number.
      *
-     * @return The account number as a string.
+     * @return The account number (usable as a `string_view`).
      */
-    string getAccountNumber() const
+    const clsAccountNumber & getAccountNumber() const
     {
         return _accountNumber;
     }
 
+    /**
+     * @brief Retrieves the client's account number packed into a 64-bit key, for indexing and sorting.
+     */
+    clsAccountKey getAccountKey() const
+    {
+        return clsAccountKey(_accountNumber);
+    }
+
     /**
      * @brief Retrieves the client's account balance.
      *
@@ -262,9 +351,9 @@ public:
     /**
      * @brief Retrieves the client's PIN code.
      *
-     * @return The PIN code as a string.
+     * @return The PIN code (usable as a `string_view`).
      */
-    string getPinCode() const
+    const clsPinCode & getPinCode() const
     {
         return _pinCode;
     }
@@ -300,7 +389,7 @@ public:
      *
      * @return True if the object is empty, false otherwise.
      */
-    bool isEmpty();
+    bool isEmpty() const;
 
     /**
      * @brief Loads client records from a file into a vector.
@@ -314,13 +403,51 @@ public:
      */
     static vector <clsBankClient> getListVectorFromFile(const string& fileName);
 
+    /**
+     * @brief Copies every client into an arena, as read-only views.
+     *
+     * @param fileName Name (or path) of the clients data file.
+     * @param arena The arena holding the views; they must not outlive it.
+     * @return The client views, in file order (the array itself lives in the arena too).
+     */
+    static clsArenaVector <stClientView> getClientViews(const string& fileName, clsArena & arena);
+
+    /**
+     * @brief Copies the balance column of every client, in file order, for reports.
+     *
+     * @param fileName Name (or path) of the clients data file.
+     */
+    static vector <double> getBalanceColumn(const string& fileName);
+
     /**
      * @brief Searches for a client by account number.
      *
      * @param accountNumber The account number to search for.
-     * @return The clsBankClient object if found, otherwise an empty client object.
+     * @return The cached client if found, otherwise a shared empty client object. The reference
+     *         stays valid until the clients file is changed; copy the client to keep it longer.
+     */
+    static const clsBankClient & findClient(const string& accountNumber);
+
+    /**
+     * @brief Searches the clients by name: prefix of the first, last or full name, or any part of it.
+     *
+     * The name index is built on the first search and then kept up to date by every add, update and
+     * delete made through this class; it is rebuilt only when the clients file is reloaded.
+     *
+     * @param query Any part of a name, in any case.
+     * @param maxResults The number of matches to return at most.
+     * @return The matches, best first; `stNameMatch::id` is the account number.
+     */
+    static vector <stNameMatch> findClientsByName(const string& query, size_t maxResults = 20);
+
+    /**
+     * @brief Lists the account numbers that start with a prefix, in order, from an in-memory radix tree.
+     *
+     * @param prefix The first characters of an account number.
+     * @param limit The number of account numbers to return at most.
+     * @param totalMatches Optional; receives how many account numbers start with the prefix in total.
      */
-    static clsBankClient findClient(const string& accountNumber);
+    static vector <string> suggestAccountNumbers(const string& prefix, size_t limit, size_t * totalMatches = nullptr);
 
     /**
      * @brief Finds a client by account number and returns it by reference from a provided vector.
@@ -368,17 +495,28 @@ public:
     void deleteInfo();
 
     /**
-     * @brief Displays the total balances of all clients along with individual balances.
+     * @brief Returns the sum of every client's account balance.
      *
-     * Loads all clients from the data file into a vector, then loop through every clsBankClient object to get
-     * its account balance to be calculated in a different variable.
-     *
-     * @return the sum of each client account balances as a double.
+     * Read from the repository's running totals, so it costs O(1) instead of a pass over the file.
      */
     static double calculateTotalBalances();
 
     /**
-     * @brief Displays the total balances of all clients along with individual balances.
+     * @brief Returns the running bank-wide totals: balance, client count and balance buckets (O(1)).
+     */
+    static clsBalanceTotals getTotals();
+
+    /**
+     * @brief Checks the running totals against a full recompute over every client.
+     *
+     * @param recomputed Optional; receives the recomputed totals.
+     * @return true if they match.
+     */
+    static bool verifyTotals(clsBalanceTotals * recomputed = nullptr);
+
+    /**
+     * @brief Displays the total balances summary (client count, balance buckets, total), then, on
+     * request, the balance of every client and a verification of the totals.
      */
     static void showTotalBalances();
 
@@ -397,12 +535,42 @@ public:
      */
     static void saveClientDataIntoFile(const string& fileName,const vector <clsBankClient>& vClients);
 
+    /**
+     * @brief Persists a single client record.
+     *
+     * Only this record is written (one journal line); a client marked with the delete sign is removed.
+     *
+     * @param fileName Path to the clients data file.
+     * @param client The client to save.
+     */
+    static void saveClientRecord(const string& fileName, const clsBankClient& client);
+
+    /**
+     * @brief Adds a new client record by appending one line to the journal, without rewriting the file.
+     *
+     * @param fileName Path to the clients data file.
+     * @param client The new client (its account number must not exist yet).
+     * @return false if a client with this account number already exists; nothing is written then.
+     */
+    static bool addClientRecord(const string& fileName, const clsBankClient& client);
+
+    /**
+     * @brief Persists several changed client records as one atomic batch (e.g. both sides of a transfer).
+     *
+     * @param fileName Path to the clients data file.
+     * @param vChangedClients The clients to save.
+     */
+    static void saveClientRecords(const string& fileName, const vector <clsBankClient>& vChangedClients);
+
     /**
      * @brief Reads an account number from user input with validation.
      *
      * Depending on the provided status, validates whether the entered account number
      * exists or is new:
      * - If status is Exist, keeps prompting until a valid existing account number is entered.
+     *   A prefix matching a single account number is offered and used once the user confirms it
+     *   (otherwise a new account number is read); a prefix matching several
+     *   lists the first ones and asks for more characters.
      * - If status is New, keeps prompting until a unique new account number is entered.
      *
      * @param status The validation mode: Exist (must already exist) or New (must not exist).
@@ -417,4 +585,56 @@ public:
     friend class clsAddNewClientScreen;
     friend class clsDeleteClientScreen;
     friend class clsUpdateClientScreen;
+    friend struct clsEntityTraits<clsBankClient>;
+};
+
+/**
+ * @brief Serialization hooks used by `clsRepository<clsBankClient>`; clients are keyed by account number.
+ */
+template <>
+struct clsEntityTraits<clsBankClient>
+{
+    static const char * name()
+    {
+        return "client";
+    }
+
+    static string key(const clsBankClient & client)
+    {
+        return client.getAccountNumber().str();
+    }
+
+    using IndexKey = clsAccountKey;
+
+    static IndexKey indexKey(string_view accountNumber)
+    {
+        return clsAccountKey(accountNumber);
+    }
+
+    static IndexKey indexKey(const clsBankClient & client)
+    {
+        return client.getAccountKey();
+    }
+
+    // lookups must not intern the account numbers they are asked about.
+    static bool probeKey(string_view accountNumber, IndexKey & indexKey)
+    {
+        return clsAccountKey::findExisting(accountNumber, indexKey);
+    }
+
+    // the bank-wide balance, client count and balance buckets, kept up to date by the repository.
+    using Totals = clsBalanceTotals;
+
+    static void addToTotals(Totals & totals, const clsBankClient & client)
+    {
+        totals.add(client.getAccountBalance());
+    }
+
+    static void removeFromTotals(Totals & totals, const clsBankClient & client)
+    {
+        totals.remove(client.getAccountBalance());
+    }
+
+    static clsBankClient fromLine(const string& line);
+    static string toLine(const clsBankClient & client);
 };
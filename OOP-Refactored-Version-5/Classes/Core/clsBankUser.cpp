@@ -14,6 +14,11 @@ clsBankUser clsBankUser::_convertLineIntoUserObject(const string& userRecord, co
     vector <string> vUserData;
 
     clsString::split(userRecord, vUserData, sep);
+
+    // a truncated user name would be written back truncated, and could collide: refuse the record instead.
+    if (!clsUserName::fits(vUserData[4]))
+        throw length_error("User record with a user name longer than " + to_string(clsUserName::capacity()) + " characters: " + userRecord);
+
     return clsBankUser(enMode::UpdateMode, vUserData[0], vUserData[1], vUserData[2], vUserData[3], vUserData[4], vUserData[5], stod(vUserData[6]));
 }
 
@@ -41,28 +46,7 @@ void clsBankUser::_rebuildPermissionsFromAccessValue(clsBankUser & user)
 
 vector <clsBankUser> clsBankUser::_loadUserDataFileIntoVector(const string& fileName)
 {
-    vector <clsBankUser> vUsers;
-
-    fstream myFile;
-    myFile.open(fileName, ios::in);
-
-    if (myFile.is_open())
-    {
-        string line;
-
-        while(getline(myFile, line))
-        {
-            clsBankUser user = _convertLineIntoUserObject(line, "#//#");
-
-            // add the permissions flags after extracting the data from the file.
-            _rebuildPermissionsFromAccessValue(user);
-
-            vUsers.push_back(user);
-        }
-        myFile.close();
-    }
-
-    return vUsers;
+    return clsRepository<clsBankUser>::open(fileName).getAll();
 }
 
 int clsBankUser::_manageUserAccess(clsBankUser & user)
@@ -152,22 +136,10 @@ string clsBankUser::_returnUserData(const clsBankUser& userData, string sep)
 
 void clsBankUser::_saveUserDataIntoFile(const string& fileName, const vector <clsBankUser>& vUsers)
 {
-    fstream myFile;
+    clsRepository<clsBankUser> & repository = clsRepository<clsBankUser>::open(fileName);
 
-    myFile.open(fileName, ios::out);
-
-    if (myFile.is_open())
-    {
-        for (const clsBankUser & C : vUsers)
-        {
-            if (C.getDeleteSign() == false)
-            {
-                string dataLine = _returnUserData(C);
-                myFile << dataLine << endl;
-            }
-        }
-        myFile.close();
-    }
+    repository.replaceAll(vUsers);
+    repository.commit();
 }
 
 void clsBankUser::_markUserDeleteSign(clsBankUser & user)
@@ -197,11 +169,11 @@ void clsBankUser::_changeUserRecord(clsBankUser & user)
 
 
 // ----- Public Methods -----
-clsBankUser::clsBankUser(enMode mode, string firstName, string lastName, string email, string phone, string userName, string password, short accessValue) : clsPerson(firstName, lastName, email, phone)
+clsBankUser::clsBankUser(enMode mode, string firstName, string lastName, string email, string phone, string userName, string password, short accessValue) : clsPerson(move(firstName), move(lastName), move(email), move(phone))
 {
     _mode = mode;
     _userName = userName;
-    _password = password;
+    _password = move(password);
     _accessValue = accessValue;
 }
 
@@ -240,41 +212,65 @@ vector <clsBankUser> clsBankUser::getListVectorFromFile(const string& fileName)
     return _loadUserDataFileIntoVector(fileName);
 }
 
-clsBankUser clsBankUser::findUser(const string& userName)
+clsArenaVector <stUserView> clsBankUser::getUserViews(const string& fileName, clsArena & arena)
 {
-    vector <clsBankUser> vUsers = _loadUserDataFileIntoVector(UsersDataFile);
+    const vector <clsBankUser> & vUsers = clsRepository<clsBankUser>::open(fileName).getAll();
 
-    for (const clsBankUser & user: vUsers)
+    clsArenaVector <stUserView> vViews {clsArenaAllocator<stUserView>(arena)};
+    vViews.reserve(vUsers.size());
+
+    for (const clsBankUser & user : vUsers)
     {
-        if (user.getUserName() == userName)
-        {
-            return user;
-        }
+        stUserView view;
+
+        view.userName = arena.copyString(user._userName);
+        view.firstName = arena.copyString(user.getFirstName());
+        view.lastName = arena.copyString(user.getLastName());
+        view.phone = arena.copyString(user.getPhone());
+        view.email = arena.copyString(user.getEmail());
+        view.accessValue = user._accessValue;
+
+        vViews.push_back(view);
     }
+    return vViews;
+}
 
-    return _getEmptyUserObject();
+void clsBankUser::saveUserRecord(const string& fileName, const clsBankUser& user)
+{
+    clsRepository<clsBankUser> & repository = clsRepository<clsBankUser>::open(fileName);
+
+    repository.save(user);
+    repository.commit();
 }
 
-clsBankUser clsBankUser::findUserByUserNameAndPassword(const string& userName, const string& password)
+bool clsBankUser::addUserRecord(const string& fileName, const clsBankUser& user)
 {
-    vector <clsBankUser> vUsers = _loadUserDataFileIntoVector(UsersDataFile);
+    return clsRepository<clsBankUser>::open(fileName).append(user);
+}
 
-    for (const clsBankUser & user: vUsers)
-    {
-        if (user.getUserName() == userName && user.getPassword() == password)
-        {
-            return user;
-        }
-    }
+const clsBankUser & clsBankUser::findUser(const string& userName)
+{
+    static const clsBankUser emptyUser = _getEmptyUserObject();
 
-    return _getEmptyUserObject();
+    const clsBankUser * user = clsRepository<clsBankUser>::open(UsersDataFile).find(userName);
+    return user != nullptr ? *user : emptyUser;
+}
+
+clsBankUser clsBankUser::findUserByUserNameAndPassword(const string& userName, const string& password)
+{
+    const clsBankUser * user = clsRepository<clsBankUser>::open(UsersDataFile).find(userName);
+    return (user != nullptr && user->getPassword() == password) ? *user : _getEmptyUserObject();
 }
 
 clsBankUser & clsBankUser::findUserRef(const string& userName, vector <clsBankUser> & vUsers)
 {
+    if (!clsUserName::fits(userName)) throw runtime_error("User Not Found");
+
+    const clsUserName key(userName);
+
     for (clsBankUser & user: vUsers)
     {
-        if (user.getUserName() == userName)
+        if (user.getUserName() == key)
         {
             return user;
         }
@@ -284,8 +280,7 @@ clsBankUser & clsBankUser::findUserRef(const string& userName, vector <clsBankUs
 
 bool clsBankUser::isUserExist(string userName)
 {
-    clsBankUser user = findUser(userName);
-    return (!user.isEmpty());
+    return clsRepository<clsBankUser>::open(UsersDataFile).exists(userName);
 }
 
 bool clsBankUser::isUserExist(string userName, string password)
@@ -296,8 +291,6 @@ bool clsBankUser::isUserExist(string userName, string password)
 
 void clsBankUser::updateInfo()
 {
-    vector <clsBankUser> vUsers = _loadUserDataFileIntoVector(UsersDataFile);
-
     this->print();
 
     char ans = clsUtil::confirm("Are You sure You want to update this account data (Y/N)? ");
@@ -312,17 +305,8 @@ void clsBankUser::updateInfo()
 
             _changeUserRecord(*this);
 
-            // * to update the vector and the file with the new user record
-            for (clsBankUser &user: vUsers)
-            {
-                if (user.getUserName() == this->getUserName())
-                {
-                    user = *this;
-                    break;
-                }
-            }
-
-            _saveUserDataIntoFile(UsersDataFile, vUsers);
+            // * only the updated record is written to the file.
+            saveUserRecord(UsersDataFile, *this);
 
             cout << "\nUser Updated Successfully." << endl;
         }
@@ -332,8 +316,6 @@ void clsBankUser::updateInfo()
 
 void clsBankUser::deleteInfo()
 {
-    vector <clsBankUser> vUsers = _loadUserDataFileIntoVector(UsersDataFile);
-
     if (!this->isEmpty())
     {
         this->print();
@@ -344,17 +326,8 @@ void clsBankUser::deleteInfo()
         {
             _markUserDeleteSign(*this);
 
-            //* to delete the user from the vector and the file.
-            for (clsBankUser &user: vUsers)
-            {
-                if (user.getUserName() == this->getUserName())
-                {
-                    user = *this;
-                    break;
-                }
-            }
-
-            _saveUserDataIntoFile(UsersDataFile, vUsers);
+            //* only the deletion of this record is written to the file.
+            saveUserRecord(UsersDataFile, *this);
             *this = _getEmptyUserObject();
             cout << "\nUser Deleted Successfully." << endl;
         }
@@ -371,8 +344,10 @@ void clsBankUser::printAccessDeniedMessage()
 
 string clsBankUser::readUserName(enStatus status)
 {
+    string tooLongMessage = "User Name is too long, Enter at most " + to_string(clsUserName::capacity()) + " characters: ";
+
     cout << "Please Enter a User Name: ";
-    string userName = clsInputValidation::readString();
+    string userName = clsInputValidation::readString(clsUserName::capacity(), tooLongMessage);
 
     switch(status)
     {
@@ -381,7 +356,7 @@ string clsBankUser::readUserName(enStatus status)
             while(!clsBankUser::isUserExist(userName))
             {
                 cout << "User with [" << userName << "] do not exist, enter an existed one: ";
-                userName = clsInputValidation::readString();
+                userName = clsInputValidation::readString(clsUserName::capacity(), tooLongMessage);
             }
             break;
         }
@@ -390,7 +365,7 @@ string clsBankUser::readUserName(enStatus status)
             while(clsBankUser::isUserExist(userName))
             {
                 cout << "User with [" << userName << "] exists, enter New UserName: ";
-                userName = clsInputValidation::readString();
+                userName = clsInputValidation::readString(clsUserName::capacity(), tooLongMessage);
             }
         }
     }
@@ -404,3 +379,18 @@ bool clsBankUser::isUserHasPermission(enPermissions permission)
 
     return false;
 }
+
+// ----- Repository Traits -----
+clsBankUser clsEntityTraits<clsBankUser>::fromLine(const string& line)
+{
+    clsBankUser user = clsBankUser::_convertLineIntoUserObject(line, "#//#");
+
+    // add the permissions flags after extracting the data from the file.
+    clsBankUser::_rebuildPermissionsFromAccessValue(user);
+    return user;
+}
+
+string clsEntityTraits<clsBankUser>::toLine(const clsBankUser & user)
+{
+    return clsBankUser::_returnUserData(user);
+}
@@ -28,6 +28,7 @@
  * FirstName#//#LastName#//#Email#//#Phone#//#UserName#//#Password#//#AccessValue
  * ```
  * Deleted users are not saved back to the file; they are skipped during the save process.
+ * File access goes through `clsRepository<clsBankUser>`, which caches and indexes the records by user name.
  *
  * ## Relationships
  * - **Inherits from:** `clsPerson` — for basic identity/contact info.
@@ -48,7 +49,11 @@
  * - Const correctness is applied to getters so they can be called on const objects.
  * - Vectors are passed by `const&` when not modified, improving performance.
  * - `findUserByUserNameAndPassword()` returns a **copy** of the matched user
- *   (safe for modifications after retrieval).
+ *   (safe for modifications after retrieval); `findUser()` returns a const reference to the
+ *   cached user, for screens that only print it.
+ * - The user name is a `clsFixedString` stored inside the object; `getUserName()` returns a const reference.
+ *   A record whose user name does not fit is refused on load (`length_error`), never truncated.
+ * - `getUserViews()` copies all users into a `clsArena` (`stUserView`) for the list screen.
  *
  * @note This class is tightly integrated with the file I/O layer and the screen classes.
  *       It should be modified carefully to maintain data integrity.
@@ -62,8 +67,26 @@
 #include <vector>
 #include "clsPerson.h"
 #include "clsEnums.h"
+#include "../Templates/clsRepository.h"
+#include "../Utils/clsArena.h"
+#include "../Utils/clsFixedString.h"
 using namespace std;
 
+// user names are short and bounded: they are stored inline in the user.
+using clsUserName = clsFixedString<31>;
+
+/**
+ * @struct stUserView
+ * @brief An arena-aware, read-only copy of a user for list screens (the password is not copied).
+ *
+ * The text fields view bytes owned by the `clsArena` passed to `clsBankUser::getUserViews()`.
+ */
+struct stUserView
+{
+    string_view userName, firstName, lastName, phone, email;
+    short accessValue = 0;
+};
+
 /**
  * @class clsBankUser
  * @brief Represents a User in the banking system.
@@ -83,7 +106,8 @@ private:
             transactions = false, managingUsers = false, loginRecords = false;
     };
 
-    string _userName, _password;
+    clsUserName _userName;
+    string _password;
     enMode _mode;
     stPermissions _permissions;
     short _accessValue;
@@ -133,8 +157,8 @@ private:
     /**
      * @brief Reads all user records from a file and loads them into a vector of clsBankUser objects.
      *
-     * Opens the specified file, reads each line as a user record, converts it into a clsBankUser object,
-     * and appends it to the resulting vector. Permissions are rebuilt for each user after loading.
+     * Returns a copy of the records cached by the users `clsRepository`; the file itself is only parsed
+     * again when it changed on disk. Permissions are rebuilt for each user when the file is parsed.
      *
      * @param fileName The path to the file containing user records.
      * @return A vector of clsBankUser objects loaded from the file.
@@ -166,7 +190,7 @@ private:
     /**
      * @brief save each user record string serialized from the clsBankUser vector to a file (acting as a database)
      *
-     * Converts each clsBankUser object in the given vector into a serialized string and writes it to the specified file,      * overwriting any existing content.
+     * Hands the vector to the users `clsRepository`, which rewrites the file only if a record actually changed.
      * Records marked for deletion are skipped
      *
      * @param fileName the main file used to stored serialized users records.
@@ -214,9 +238,9 @@ public:
 
     /**
      * @brief Gets the username of the user.
-     * @return Username as a string.
+     * @return Username (usable as a `string_view`).
      */
-    string getUserName() const
+    const clsUserName & getUserName() const
     {
         return _userName;
     }
@@ -236,14 +260,14 @@ public:
      */
     void setPassword(string Password)
     {
-        _password = Password;
+        _password = move(Password);
     }
 
     /**
      * @brief Gets the user's password.
-     * @return Password as a string.
+     * @return Reference to the password.
      */
-    string getPassword() const
+    const string& getPassword() const
     {
         return _password;
     }
@@ -347,6 +371,34 @@ public:
      */
     static vector <clsBankUser> getListVectorFromFile(const string& fileName);
 
+    /**
+     * @brief Copies every user into an arena, as read-only views.
+     *
+     * @param fileName Name (or path) of the users data file.
+     * @param arena The arena holding the views; they must not outlive it.
+     * @return The user views, in file order (the array itself lives in the arena too).
+     */
+    static clsArenaVector <stUserView> getUserViews(const string& fileName, clsArena & arena);
+
+    /**
+     * @brief Persists a single user record.
+     *
+     * Only this record is written (one journal line); a user marked with the delete sign is removed.
+     *
+     * @param fileName Path to the users data file.
+     * @param user The user to save.
+     */
+    static void saveUserRecord(const string& fileName, const clsBankUser& user);
+
+    /**
+     * @brief Adds a new user record by appending one line to the journal, without rewriting the file.
+     *
+     * @param fileName Path to the users data file.
+     * @param user The new user (its user name must not exist yet).
+     * @return false if a user with this user name already exists; nothing is written then.
+     */
+    static bool addUserRecord(const string& fileName, const clsBankUser& user);
+
     /**
      * @brief Searches for a user in the data file by username.
      *
@@ -355,14 +407,10 @@ public:
      * If no match is found, returns an empty clsBankUser object.
      *
      * @param userName The username of the user to search for.
-     * @return clsBankUser A copy of the matching user if found; otherwise, an empty user object.
-     *
-     * @note This method returns a copy, so changes made to the returned object
-     *       will not affect the original data in the file.
-     * @note Performance: Each call reads all user data from the file, which may be slow
-     *       if the file is large or the method is called frequently.
+     * @return The cached user if found; otherwise, a shared empty user object. The reference stays
+     *         valid until the users file is changed; copy the user to keep it longer or to modify it.
      */
-    static clsBankUser findUser(const string& userName);
+    static const clsBankUser & findUser(const string& userName);
 
     /**
      * @brief Searches for a user in the data file by username and password.
@@ -543,4 +591,49 @@ public:
     friend class clsAddNewUserScreen;
     friend class clsDeleteUserScreen;
     friend class clsUpdateUserScreen;
+    friend struct clsEntityTraits<clsBankUser>;
+};
+
+/**
+ * @brief Serialization hooks used by `clsRepository<clsBankUser>`; users are keyed by user name.
+ */
+template <>
+struct clsEntityTraits<clsBankUser>
+{
+    static const char * name()
+    {
+        return "user";
+    }
+
+    static string key(const clsBankUser & user)
+    {
+        return user.getUserName().str();
+    }
+
+    // user names are free-form: the index keeps them as strings.
+    using IndexKey = string;
+
+    static IndexKey indexKey(string_view userName)
+    {
+        return string(userName);
+    }
+
+    static IndexKey indexKey(const clsBankUser & user)
+    {
+        return user.getUserName().str();
+    }
+
+    static bool probeKey(string_view userName, IndexKey & indexKey)
+    {
+        indexKey.assign(userName);
+        return true;
+    }
+
+    using Totals = stNoTotals;
+
+    static void addToTotals(Totals &, const clsBankUser &) {}
+    static void removeFromTotals(Totals &, const clsBankUser &) {}
+
+    static clsBankUser fromLine(const string& line);
+    static string toLine(const clsBankUser & user);
 };
@@ -15,6 +15,10 @@
  * - Defines the User Features (Showing the Users list, Adding, Deleting, Updating, Finding user,
  * and Returning to Main Menu)
  * - Defines the User/Client Status (whether Existed or New).
+ * - Defines the keys the transfer log can be sorted by.
+ * - Defines the kinds of discrepancy found by the ledger reconciliation.
+ * - Defines what is known of a balance looked up as of a past date.
+ * - Defines the Sync Policy of the data files (whether each commit is flushed to the disk or left to the OS).
  * - Defines The Users' Permissions (to the UI Features whether the logged-in User
  * has the access to use this feature or not. This class uses powers 2 (bitmask) for bitwise flags.)
  */
@@ -35,22 +39,26 @@ using namespace std;
  * - DeleteClient   (3): Remove an existing client.
  * - UpdateClientInfo (4): Edit details of an existing client.
  * - FindClient     (5): Search for a client by account number.
- * - Transactions   (6): Access the transactions sub-menu.
- * - ManageUsers    (7): Access the user management sub-menu.
- * - ShowLoginRecordsList (8): Display the login activity log.
- * - LogOut         (9): Log out of the current session.
+ * - FindClientByName (6): Search for clients by any part of their name.
+ * - Transactions   (7): Access the transactions sub-menu.
+ * - ManageUsers    (8): Access the user management sub-menu.
+ * - ShowLoginRecordsList (9): Display the login activity log.
+ * - LogOut         (10): Log out of the current session.
+ * - ShowMetrics    (0): Hidden admin entry that displays the system metrics.
  */
 enum class enChoice
 {
+    ShowMetrics = 0,
     ShowClientList = 1,
     AddNewClient = 2,
     DeleteClient = 3,
     UpdateClientInfo = 4,
     FindClient = 5,
-    Transactions = 6,
-    ManageUsers = 7,
-    ShowLoginRecordsList = 8,
-    LogOut = 9,
+    FindClientByName = 6,
+    Transactions = 7,
+    ManageUsers = 8,
+    ShowLoginRecordsList = 9,
+    LogOut = 10,
 };
 
 /**
@@ -66,7 +74,13 @@ enum class enChoice
  *  along with The sum of all balances.
  * - Transfer (4): Transfer money between two clients's accounts.
  * - ShowTransferRecordsList (5): Display the transactions activity log.
- * - MainMenu (6): Return to the main menu screen.
+ * - BalanceReport (6): Display the balance distribution report (histogram, quantiles) and export it as CSV.
+ * - PostInterest (7): Run the end-of-day interest posting over every client account (full-access users only).
+ * - Statements (8): Write the monthly statement of every account from the transfer log.
+ * - Reconcile (9): Cross-check the balances of the transfer log against the clients file.
+ * - BalanceAsOf (10): Show the balance of an account on a past date.
+ * - TransferAnalytics (11): Print a grouped report of the transfer log (per teller, account or day).
+ * - MainMenu (12): Return to the main menu screen.
 */
 enum class enTransactionChoice
 {
@@ -75,7 +89,13 @@ enum class enTransactionChoice
     TotalBalances = 3,
     Transfer = 4,
     ShowTransferRecordsList = 5,
-    MainMenu = 6
+    BalanceReport = 6,
+    PostInterest = 7,
+    Statements = 8,
+    Reconcile = 9,
+    BalanceAsOf = 10,
+    TransferAnalytics = 11,
+    MainMenu = 12
 };
 
 /**
@@ -117,6 +137,95 @@ enum class enStatus
     Exist = 2,
 };
 
+/**
+ * @enum enTransferSortKey
+ * @brief Defines the fields the transfer log can be externally sorted by.
+ *
+ * ## Enumerators
+ * - SourceAccount (1): The account the money was transferred from.
+ * - DestinationAccount (2): The account the money was transferred to.
+ * - Timestamp (3): The date and time of the transfer.
+ * - Amount (4): The amount transferred.
+ */
+enum class enTransferSortKey
+{
+    SourceAccount = 1,
+    DestinationAccount = 2,
+    Timestamp = 3,
+    Amount = 4,
+};
+
+/**
+ * @enum enDiscrepancyKind
+ * @brief Defines the kinds of discrepancy the ledger reconciliation reports.
+ *
+ * ## Enumerators
+ * - MalformedRecord (1): A transfer log line that cannot be parsed.
+ * - BalanceGap (2): An account's balance before a transfer differs from its balance after its previous transfer.
+ * - StoreMismatch (3): An account's balance in the clients file differs from its balance after its last transfer.
+ * - UnknownAccount (4): A transfer names an account that is not in the clients file.
+ */
+enum class enDiscrepancyKind
+{
+    MalformedRecord = 1,
+    BalanceGap = 2,
+    StoreMismatch = 3,
+    UnknownAccount = 4,
+};
+
+/**
+ * @enum enBalanceAsOfCheck
+ * @brief Defines what is known of a balance as of a past date, which only the transfer log backs.
+ *
+ * ## Enumerators
+ * - Confirmed (1): The next transfer of the account (or the clients file, if there is none) starts from that balance.
+ * - Changed (2): It starts from another balance: a deposit, withdrawal or interest posting moved the balance
+ *   between the last transfer up to the date and the next one, so the balance on the date may differ.
+ * - Unchecked (3): There is nothing to compare with (no balance found, or the account is no longer in the clients file).
+ */
+enum class enBalanceAsOfCheck
+{
+    Confirmed = 1,
+    Changed = 2,
+    Unchecked = 3,
+};
+
+/**
+ * @enum enTransferGroupKey
+ * @brief Defines the transfer log fields the transfer analytics can group by.
+ *
+ * ## Enumerators
+ * - Teller (1): The user who made the transfer.
+ * - SourceAccount (2): The account the money was transferred from.
+ * - DestinationAccount (3): The account the money was transferred to.
+ * - Account (4): Either account: a transfer counts once for its source and once for its destination.
+ * - Day (5): The day of the transfer (YYYY-MM-DD).
+ * - Hour (6): The hour of the transfer (YYYY-MM-DD HH:00).
+ */
+enum class enTransferGroupKey
+{
+    Teller = 1,
+    SourceAccount = 2,
+    DestinationAccount = 3,
+    Account = 4,
+    Day = 5,
+    Hour = 6,
+};
+
+/**
+ * @enum enSyncPolicy
+ * @brief Defines when the records written to the data files are forced onto the disk.
+ *
+ * ## Enumerators
+ * - NoSync (0): Leave the written data in the OS cache (fastest, may be lost on power failure).
+ * - SyncOnCommit (1): Flush every commit / append to the disk before returning (fsync).
+ */
+enum class enSyncPolicy
+{
+    NoSync = 0,
+    SyncOnCommit = 1,
+};
+
 /**
  * @enum enPermissions
  * @brief Defines the available permissions for a user to manage system features.
@@ -128,7 +237,7 @@ enum class enStatus
  * - adding (2): permission to add new client.
  * - deleting (4): permission to delete an existing client.
  * - updating (8): permission to update client's information.
- * - finding (16): permission to find client's information by account number.
+ * - finding (16): permission to find client's information by account number or by name.
  * - transactions (32): permission to make transactions.
  * - managingUsers (64): permission to manage users.
  * - loginRecords (128): permission to view login activity log.
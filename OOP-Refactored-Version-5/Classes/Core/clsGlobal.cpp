@@ -7,5 +7,17 @@ const std::string ClientsDataFile = "Database Text Files/Clients.txt";
 const std::string UsersDataFile = "Database Text Files/Users.txt";
 const std::string LoginRegisterFile = "Database Text Files/LoginRegister.txt";
 const std::string TransferLogsFile = "Database Text Files/Transfer.txt";
-clsBankUser currentUser = clsBankUser::findUserByUserNameAndPassword("", "");
+const std::string MetricsFile = "Database Text Files/Metrics.txt";
+const std::string BalanceReportFile = "Database Text Files/BalanceReport.csv";
+const std::string InterestRatesFile = "Database Text Files/InterestRates.txt";
+const std::string InterestLogsFile = "Database Text Files/InterestLogs.txt";
+const std::string InterestPostedDateFile = "Database Text Files/InterestPostedDate.txt";
+const std::string ReconciliationReportFile = "Database Text Files/Reconciliation.csv";
+const std::string StatementsFolder = "Database Text Files/Statements";
+const std::string TransferCheckpointsFolder = "Database Text Files/Transfer Checkpoints";
+const std::string TransferAnalyticsFile = "Database Text Files/TransferAnalytics.csv";
+const std::string ReplayScriptsFolder = "Replay Scripts";
+enSyncPolicy DataSyncPolicy = enSyncPolicy::NoSync;
+// nobody is logged in yet; built directly so that no data file is read before main() runs.
+clsBankUser currentUser(enMode::EmptyMode, "", "", "", "", "", "", 0);
 
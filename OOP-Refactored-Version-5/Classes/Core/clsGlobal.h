@@ -17,11 +17,24 @@
  * - UsersDataFile: Path to the users data file.
  * - LoginRegisterFile: Path to the login activity log file.
  * - TransferLogsFile: Path to the transfer log file.
+ * - MetricsFile: Path to the file the metrics are dumped into.
+ * - BalanceReportFile: Path to the CSV file the balance report is exported to.
+ * - InterestRatesFile: Path to the tiered interest rate table (`clsInterestRateTable`).
+ * - InterestLogsFile: Path to the interest posting log file.
+ * - InterestPostedDateFile: Path to the file holding the business date of the last interest posting.
+ * - ReconciliationReportFile: Path to the CSV file the ledger reconciliation discrepancies are exported to.
+ * - StatementsFolder: Folder the monthly account statements are written into, one subfolder per month.
+ * - TransferCheckpointsFolder: Folder holding the periodic account balance checkpoints of the transfer log and their index.
+ * - TransferAnalyticsFile: Path to the CSV file the last transfer analytics report is exported to.
+ * - ReplayScriptsFolder: Folder holding the keystroke scripts replayed by `clsSessionReplayer`.
+ * - DataSyncPolicy: Whether writes to the data files are fsync-ed on every commit (`enSyncPolicy`);
+ *   `NoSync` unless the environment variable `BANK_SYNC` is `commit` (read by `main()`).
  * - currentUser: Represents the currently logged-in user (session state).
  */
 #pragma once
 #include <iostream>
 #include <string>
+#include "clsEnums.h"
 
 class clsBankUser; // forward definition to avoid Circular Dependency Issue.
 
@@ -29,4 +42,15 @@ extern const std::string ClientsDataFile;  // Declare, but don’t define
 extern const std::string UsersDataFile;
 extern const std::string LoginRegisterFile;
 extern const std::string TransferLogsFile;
+extern const std::string MetricsFile;
+extern const std::string BalanceReportFile;
+extern const std::string InterestRatesFile;
+extern const std::string InterestLogsFile;
+extern const std::string InterestPostedDateFile;
+extern const std::string ReconciliationReportFile;
+extern const std::string StatementsFolder;
+extern const std::string TransferCheckpointsFolder;
+extern const std::string TransferAnalyticsFile;
+extern const std::string ReplayScriptsFolder;
+extern enSyncPolicy DataSyncPolicy;
 extern clsBankUser currentUser;
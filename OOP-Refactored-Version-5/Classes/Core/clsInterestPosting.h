@@ -0,0 +1,218 @@
+/**
+ * @file clsInterestPosting.h
+ * @brief Declares the `clsInterestPosting` class, the end-of-day job posting interest to every client.
+ *
+ * ## Overview
+ * Posting interest through `clsTransactionHelper::makeTransaction()` would save (and journal) every
+ * account on its own. `postInterest()` instead runs as one batch over the whole client book:
+ * 1. the interest of every account is computed in parallel from a `clsInterestRateTable` and a
+ *    number of days, and added to its balance;
+ * 2. every posting is persisted with a single durable commit (`clsRepository::rewriteAll()`);
+ * 3. one summarized log line per credited account is appended to `InterestLogsFile`.
+ *
+ * The business date of the last run is kept in `InterestPostedDateFile`: a second run on the same
+ * date is refused (every account would be credited again) unless the caller explicitly asks for it.
+ *
+ * ## Data Storage Format
+ * One line per credited account, fields separated by `#//#`:
+ * ```
+ * Timestamp#//#AccountNumber#//#BalanceBefore#//#AnnualRatePercent#//#Days#//#Interest#//#BalanceAfter#//#UserName
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The records are split into two slices per worker; every slice builds its own log text, and the
+ *   slices are appended in file order once the commit succeeded (no log line without its posting).
+ * - Accounts earning nothing (zero, negative or tiny balances) are left untouched and not logged.
+ * - Interest is rounded to the cent per account; the total is summed in cents.
+ * - The posted date is written before the postings, under a lock file shared by every terminal: a
+ *   crash in between blocks a second run of the day (until overridden) instead of allowing a double
+ *   credit. It is put back when the commit fails.
+ * - A log that cannot be written does not undo the committed postings; it is reported in the summary.
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "clsBankClient.h"
+#include "clsBankUser.h"
+#include "clsGlobal.h"
+#include "clsInterestRateTable.h"
+#include "../Utils/clsDate.h"
+#include "../Utils/clsString.h"
+#include "../Utils/clsThreadPool.h"
+#include "../Utils/clsTracer.h"
+#include "../Utils/clsFileLock.h"
+using namespace std;
+
+/**
+ * @struct stInterestRunSummary
+ * @brief The outcome of one interest posting run.
+ */
+struct stInterestRunSummary
+{
+    string businessDate;
+    bool alreadyPosted = false; // refused: the interest of `businessDate` was posted already.
+    bool committed = false;
+    bool logged = false;        // every posting has its log line in `InterestLogsFile`.
+    string error;
+    size_t accountsScanned = 0;
+    size_t accountsCredited = 0;
+    int64_t totalInterestCents = 0;
+    long long milliseconds = 0;
+};
+
+class clsInterestPosting
+{
+private:
+    static bool _appendLogs(const string& fileName, const vector <string> & vLogChunks)
+    {
+        clsTraceSpan span("clsInterestPosting::_appendLogs");
+
+        fstream myFile;
+        myFile.open(fileName, ios::out | ios::app | ios::binary);
+
+        if (!myFile.is_open()) return false;
+
+        for (const string & logChunk : vLogChunks)
+            myFile.write(logChunk.data(), logChunk.size());
+
+        myFile.close();
+        return !myFile.fail();
+    }
+
+    static bool _writePostedDate(const string& businessDate)
+    {
+        fstream myFile;
+        myFile.open(InterestPostedDateFile, ios::out);
+
+        if (!myFile.is_open()) return false;
+
+        myFile << businessDate << '\n';
+        myFile.close();
+        return !myFile.fail();
+    }
+
+public:
+    /**
+     * @brief Returns the business date (`D/M/YYYY`) interest is posted for when run now.
+     */
+    static string businessDate()
+    {
+        return clsDate::DateToString(clsDate());
+    }
+
+    /**
+     * @brief Returns the business date of the last interest posting, or an empty string if there was none.
+     */
+    static string lastPostedDate()
+    {
+        fstream myFile;
+        myFile.open(InterestPostedDateFile, ios::in);
+
+        string date;
+        if (myFile.is_open())
+        {
+            getline(myFile, date);
+            myFile.close();
+        }
+        return date;
+    }
+
+    /**
+     * @brief Credits every client with the interest of `days` days and logs every posting.
+     *
+     * @param rates The rate table.
+     * @param days The number of days the interest is accrued for (1 for a daily posting).
+     * @param postAgain Posts even if the interest of today's business date was posted already.
+     */
+    static stInterestRunSummary postInterest(const clsInterestRateTable & rates, int days, bool postAgain = false)
+    {
+        clsTraceSpan span("clsInterestPosting::postInterest");
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+        stInterestRunSummary summary;
+        summary.businessDate = businessDate();
+
+        // two terminals must not both find the date free and both post.
+        clsFileLock postingLock(InterestPostedDateFile + ".lock");
+
+        string previousDate = lastPostedDate();
+        if (previousDate == summary.businessDate && !postAgain)
+        {
+            summary.alreadyPosted = true;
+            return summary;
+        }
+
+        if (!_writePostedDate(summary.businessDate))
+        {
+            summary.error = "could not write [" + InterestPostedDateFile + "]";
+            return summary;
+        }
+
+        size_t chunkCount = clsThreadPool::shared().getThreadCount() * 2;
+        vector <string> vLogChunks(chunkCount);
+        vector <size_t> vCredited(chunkCount, 0), vScanned(chunkCount, 0);
+        vector <int64_t> vInterestCents(chunkCount, 0);
+
+        // the fields shared by every log line are formatted once.
+        string sep = "#//#";
+        string timestamp = clsDate::TimeToString(clsDate()) + sep;
+        string daysField = sep + to_string(days) + sep;
+        string userNameField = sep + currentUser.getUserName().str() + "\n";
+
+        summary.committed = clsRepository<clsBankClient>::open(ClientsDataFile).rewriteAll(
+            [&](size_t chunk, clsBankClient * begin, clsBankClient * end)
+            {
+                string & logChunk = vLogChunks[chunk];
+                vScanned[chunk] = end - begin;
+
+                for (clsBankClient * client = begin; client != end; ++client)
+                {
+                    double balanceBefore = client->getAccountBalance();
+                    int64_t interestCents = rates.interestCents(balanceBefore, days);
+                    if (interestCents == 0) continue;
+
+                    client->updateAccBalance(interestCents / 100.0);
+
+                    vCredited[chunk]++;
+                    vInterestCents[chunk] += interestCents;
+
+                    logChunk += timestamp;
+                    logChunk += client->getAccountNumber().str();
+                    logChunk += sep;
+                    clsString::appendFixed(logChunk, balanceBefore);
+                    logChunk += sep;
+                    clsString::appendFixed(logChunk, rates.rateFor(balanceBefore));
+                    logChunk += daysField;
+                    clsString::appendFixed(logChunk, interestCents / 100.0);
+                    logChunk += sep;
+                    clsString::appendFixed(logChunk, client->getAccountBalance());
+                    logChunk += userNameField;
+                }
+            }, chunkCount);
+
+        if (summary.committed)
+        {
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+            {
+                summary.accountsScanned += vScanned[chunk];
+                summary.accountsCredited += vCredited[chunk];
+                summary.totalInterestCents += vInterestCents[chunk];
+            }
+
+            summary.logged = _appendLogs(InterestLogsFile, vLogChunks);
+            if (!summary.logged)
+                summary.error = "the postings are saved, but their log lines could not be written to [" + InterestLogsFile + "]";
+        }
+        else
+        {
+            summary.error = "the clients file could not be rewritten";
+            _writePostedDate(previousDate);
+        }
+
+        summary.milliseconds = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+        return summary;
+    }
+};
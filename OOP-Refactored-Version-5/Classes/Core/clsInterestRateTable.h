@@ -0,0 +1,146 @@
+/**
+ * @file clsInterestRateTable.h
+ * @brief Declares the `clsInterestRateTable` class, the tiered annual interest rates of the bank.
+ *
+ * ## Overview
+ * A client's balance earns the annual rate of the highest tier it reaches, prorated by a day
+ * count: `interest = balance x rate / 100 x days / basis`, rounded to the cent.
+ *
+ * ## Data Storage Format
+ * `InterestRatesFile` holds an optional day-count basis line and one line per tier, using the
+ * same `#//#` separator as the data files:
+ * ```
+ * Basis#//#365
+ * MinimumBalance#//#AnnualRatePercent
+ * ```
+ * When the file is missing or holds no tier, the default table below is used:
+ * | Minimum Balance | Annual Rate |
+ * |-----------------|-------------|
+ * | 0               | 0.5%        |
+ * | 10,000          | 1%          |
+ * | 100,000         | 1.5%        |
+ * | 1,000,000       | 2%          |
+ *
+ * ## Notable Implementation Details
+ * - Tiers are kept sorted by minimum balance; finding the tier of a balance is a binary search.
+ * - A balance below the lowest tier (e.g. a negative balance) earns nothing.
+ * - `interestCents()` only reads the table, so the posting workers share one table.
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include "../Utils/clsString.h"
+using namespace std;
+
+/**
+ * @struct stRateTier
+ * @brief One tier: balances from `minimumBalance` up earn `annualRatePercent` a year.
+ */
+struct stRateTier
+{
+    double minimumBalance = 0;
+    double annualRatePercent = 0;
+};
+
+class clsInterestRateTable
+{
+private:
+    vector <stRateTier> _vTiers;
+    int _dayCountBasis = 365;
+
+    void _sortTiers()
+    {
+        sort(_vTiers.begin(), _vTiers.end(),
+             [](const stRateTier & a, const stRateTier & b) { return a.minimumBalance < b.minimumBalance; });
+    }
+
+public:
+    clsInterestRateTable()
+    {
+        _vTiers = {{0, 0.5}, {10000, 1}, {100000, 1.5}, {1000000, 2}};
+    }
+
+    clsInterestRateTable(vector <stRateTier> vTiers, int dayCountBasis)
+        : _vTiers(move(vTiers)), _dayCountBasis(dayCountBasis)
+    {
+        _sortTiers();
+    }
+
+    /**
+     * @brief Reads a rate table file; falls back to the default table when it holds no tier.
+     */
+    static clsInterestRateTable loadFromFile(const string& fileName)
+    {
+        clsInterestRateTable table;
+        vector <stRateTier> vTiers;
+
+        fstream myFile;
+        myFile.open(fileName, ios::in);
+
+        if (myFile.is_open())
+        {
+            string line;
+
+            while (getline(myFile, line))
+            {
+                vector <string> vFields;
+                clsString::split(line, vFields, "#//#");
+                if (vFields.size() != 2) continue;
+
+                try
+                {
+                    if (vFields[0] == "Basis")
+                        table._dayCountBasis = max(1, stoi(vFields[1]));
+                    else
+                        vTiers.push_back({stod(vFields[0]), stod(vFields[1])});
+                }
+                catch (const exception &)
+                {
+                    // a malformed line is skipped, like a malformed record.
+                }
+            }
+            myFile.close();
+        }
+
+        if (!vTiers.empty())
+        {
+            table._vTiers = move(vTiers);
+            table._sortTiers();
+        }
+        return table;
+    }
+
+    const vector <stRateTier> & getTiers() const
+    {
+        return _vTiers;
+    }
+
+    int getDayCountBasis() const
+    {
+        return _dayCountBasis;
+    }
+
+    /**
+     * @brief Returns the annual rate (in percent) earned by a balance.
+     */
+    double rateFor(double balance) const
+    {
+        auto it = upper_bound(_vTiers.begin(), _vTiers.end(), balance,
+                              [](double value, const stRateTier & tier) { return value < tier.minimumBalance; });
+
+        return it == _vTiers.begin() ? 0 : prev(it)->annualRatePercent;
+    }
+
+    /**
+     * @brief Returns the interest earned by a balance over a number of days, in whole cents.
+     */
+    int64_t interestCents(double balance, int days) const
+    {
+        return (int64_t)llround(balance * rateFor(balance) * days / _dayCountBasis);
+    }
+};
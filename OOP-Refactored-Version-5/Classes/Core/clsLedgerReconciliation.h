@@ -0,0 +1,406 @@
+/**
+ * @file clsLedgerReconciliation.h
+ * @brief Declares the `clsLedgerReconciliation` class, which cross-checks the transfer log against the clients file.
+ *
+ * ## Overview
+ * Every transfer log line records the balances of both accounts after the transfer. `reconcile()`
+ * replays those running balances account by account and reports where they do not add up:
+ * 1. the log is streamed once (`clsLogScanner::forEachWithOffsets()`); every transfer becomes a
+ *    debit of its source and a credit of its destination, partitioned by account in a
+ *    `clsSpillingPartitioner` (bounded memory, spilling to disk beyond the budget);
+ * 2. the partitions are replayed in parallel on the shared `clsThreadPool`: the movements of every
+ *    account are walked in log order, checking that each one starts from the balance the previous
+ *    one left;
+ * 3. the balance the log leaves every account is compared with the account in `ClientsDataFile`.
+ *
+ * Every discrepancy (`enDiscrepancyKind`) carries the byte offset of the offending log line (and,
+ * for a gap, the offset of the previous line of the account), so it can be found with any editor.
+ *
+ * ## Data Storage Format
+ * The discrepancies are exported, ordered by offset, to `ReconciliationReportFile`:
+ * ```
+ * Kind,Account,Offset,PreviousOffset,Expected,Recorded,Difference
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - Deposits, withdrawals and interest postings are not in the transfer log: the balance changes
+ *   they cause between two transfers are reported as gaps, with the amount of the change.
+ * - Balances are stored as `float`, so two balances match within a cent or two float roundings,
+ *   whichever is larger.
+ * - Accounts without any transfer are not checked.
+ * - The client balances are copied into a map before the workers start, and every worker checks the
+ *   accounts of its partition against that snapshot; the workers never read the client cache.
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <cmath>
+#include <charconv>
+#include <filesystem>
+#include "clsBankClient.h"
+#include "clsEnums.h"
+#include "clsGlobal.h"
+#include "../Utils/clsLogScanner.h"
+#include "../Utils/clsSpillingPartitioner.h"
+#include "../Utils/clsString.h"
+#include "../Utils/clsThreadPool.h"
+#include "../Utils/clsTracer.h"
+using namespace std;
+
+/**
+ * @struct stLedgerDiscrepancy
+ * @brief One place where the transfer log and the clients file disagree.
+ *
+ * `expected` is the balance the ledger leads to (the previous balance of a gap, the last logged
+ * balance of a store mismatch); `recorded` is the balance found instead.
+ */
+struct stLedgerDiscrepancy
+{
+    enDiscrepancyKind kind = enDiscrepancyKind::MalformedRecord;
+    string accountNumber;
+    uint64_t offset = 0;
+    uint64_t previousOffset = 0;
+    double expected = 0;
+    double recorded = 0;
+};
+
+/**
+ * @struct stReconciliationSummary
+ * @brief The outcome of one reconciliation run.
+ */
+struct stReconciliationSummary
+{
+    bool completed = false;
+    string error;
+    size_t recordsScanned = 0;
+    size_t accountsChecked = 0;
+    size_t partitionCount = 0;
+    uint64_t spilledBytes = 0;
+    long long milliseconds = 0;
+    vector <stLedgerDiscrepancy> vDiscrepancies;
+
+    size_t countOf(enDiscrepancyKind kind) const
+    {
+        return count_if(vDiscrepancies.begin(), vDiscrepancies.end(),
+                        [kind](const stLedgerDiscrepancy & discrepancy) { return discrepancy.kind == kind; });
+    }
+};
+
+class clsLedgerReconciliation
+{
+private:
+    /**
+     * @brief A transfer of the log, as the debit and credit lines it adds to the partitions.
+     */
+    struct _stLedgerTransfer
+    {
+        bool malformed = false;
+        uint64_t offset = 0;
+        string sourceAccount, destinationAccount;
+        string debitLine, creditLine;
+    };
+
+    /**
+     * @brief The last movement of an account: where the ledger leaves its balance.
+     */
+    struct _stAccountEnd
+    {
+        string accountNumber;
+        uint64_t offset = 0;
+        double balance = 0;
+    };
+
+    /**
+     * @brief One movement of an account, read back from a partition.
+     */
+    struct _stMovement
+    {
+        string_view account;
+        uint64_t offset = 0;
+        double signedAmount = 0;
+        double balanceAfter = 0;
+    };
+
+    static bool _isNumber(string_view s)
+    {
+        double value = 0;
+        from_chars_result result = from_chars(s.data(), s.data() + s.size(), value);
+        return result.ec == errc() && result.ptr == s.data() + s.size();
+    }
+
+    static uint64_t _parseOffset(string_view s)
+    {
+        uint64_t value = 0;
+        from_chars(s.data(), s.data() + s.size(), value);
+        return value;
+    }
+
+    /**
+     * @brief Builds one movement line: `Account#//#Offset#//#Sign#//#Amount#//#BalanceAfter`.
+     */
+    static string _movementLine(string_view account, const string& offset, char sign, string_view amount, string_view balanceAfter)
+    {
+        string line;
+        line.reserve(account.size() + offset.size() + amount.size() + balanceAfter.size() + 20);
+
+        line.append(account);
+        line += "#//#" + offset + "#//#";
+        line += sign;
+        line += "#//#";
+        line.append(amount);
+        line += "#//#";
+        line.append(balanceAfter);
+
+        return line;
+    }
+
+    static _stLedgerTransfer _parseTransfer(const string& line, uint64_t offset)
+    {
+        _stLedgerTransfer transfer;
+        transfer.offset = offset;
+
+        string_view arFields[7];
+        if (clsString::splitView(line, arFields, 7, "#//#") != 7 || !_isNumber(arFields[3]) ||
+            !_isNumber(arFields[4]) || !_isNumber(arFields[5]))
+        {
+            transfer.malformed = true;
+            return transfer;
+        }
+
+        string offsetText = to_string(offset);
+
+        transfer.sourceAccount.assign(arFields[1]);
+        transfer.destinationAccount.assign(arFields[2]);
+        transfer.debitLine = _movementLine(arFields[1], offsetText, '-', arFields[3], arFields[4]);
+        transfer.creditLine = _movementLine(arFields[2], offsetText, '+', arFields[3], arFields[5]);
+
+        return transfer;
+    }
+
+    static bool _sameBalance(double a, double b)
+    {
+        return fabs(a - b) <= max(0.01, max(fabs(a), fabs(b)) * 2.4e-7);
+    }
+
+    /**
+     * @brief Replays the movements of one account, in log order, and returns where they leave its balance.
+     */
+    static _stAccountEnd _checkAccount(const _stMovement * begin, const _stMovement * end, vector <stLedgerDiscrepancy> & vDiscrepancies)
+    {
+        string accountNumber(begin->account);
+
+        for (const _stMovement * movement = begin + 1; movement != end; ++movement)
+        {
+            const _stMovement & previous = movement[-1];
+            double balanceBefore = movement->balanceAfter - movement->signedAmount;
+
+            if (!_sameBalance(balanceBefore, previous.balanceAfter))
+                vDiscrepancies.push_back({enDiscrepancyKind::BalanceGap, accountNumber, movement->offset,
+                                          previous.offset, previous.balanceAfter, balanceBefore});
+        }
+
+        return {accountNumber, end[-1].offset, end[-1].balanceAfter};
+    }
+
+    /**
+     * @brief Copies the balance of every client, by account number, on the calling thread.
+     */
+    static unordered_map <string, float> _clientBalances()
+    {
+        unordered_map <string, float> mpBalances;
+
+        for (const clsBankClient & client : clsRepository<clsBankClient>::open(ClientsDataFile).getAll())
+            mpBalances[client.getAccountNumber().str()] = client.getAccountBalance();
+
+        return mpBalances;
+    }
+
+    /**
+     * @brief Compares the balance the ledger leaves every account with the snapshot of the clients file.
+     */
+    static void _checkStore(const vector <_stAccountEnd> & vAccountEnds, const unordered_map <string, float> & mpClientBalances,
+                            vector <stLedgerDiscrepancy> & vDiscrepancies)
+    {
+        for (const _stAccountEnd & accountEnd : vAccountEnds)
+        {
+            auto client = mpClientBalances.find(accountEnd.accountNumber);
+
+            if (client == mpClientBalances.end())
+                vDiscrepancies.push_back({enDiscrepancyKind::UnknownAccount, accountEnd.accountNumber, accountEnd.offset, 0, accountEnd.balance, 0});
+            else if (!_sameBalance(client->second, accountEnd.balance))
+                vDiscrepancies.push_back({enDiscrepancyKind::StoreMismatch, accountEnd.accountNumber, accountEnd.offset, 0,
+                                          accountEnd.balance, client->second});
+        }
+    }
+
+    /**
+     * @brief Groups one partition by account and replays every account.
+     */
+    static void _checkPartition(const string& lines, vector <stLedgerDiscrepancy> & vDiscrepancies, vector <_stAccountEnd> & vAccountEnds)
+    {
+        vector <_stMovement> vMovements;
+
+        size_t begin = 0;
+        while (begin < lines.size())
+        {
+            size_t lineEnd = lines.find('\n', begin);
+            if (lineEnd == string::npos) lineEnd = lines.size();
+
+            string_view arFields[5];
+            if (clsString::splitView(string_view(lines).substr(begin, lineEnd - begin), arFields, 5, "#//#") == 5)
+            {
+                double amount = clsString::parseDouble(arFields[3]);
+                vMovements.push_back({arFields[0], _parseOffset(arFields[1]), arFields[2] == "-" ? -amount : amount,
+                                      clsString::parseDouble(arFields[4])});
+            }
+            begin = lineEnd + 1;
+        }
+
+        // the partition keeps the log order, so a stable sort leaves the movements of an account in that order.
+        stable_sort(vMovements.begin(), vMovements.end(),
+                    [](const _stMovement & a, const _stMovement & b) { return a.account < b.account; });
+
+        for (size_t first = 0; first < vMovements.size();)
+        {
+            size_t last = first;
+            while (last < vMovements.size() && vMovements[last].account == vMovements[first].account)
+                last++;
+
+            vAccountEnds.push_back(_checkAccount(vMovements.data() + first, vMovements.data() + last, vDiscrepancies));
+
+            first = last;
+        }
+    }
+
+public:
+    static const size_t defaultMemoryBudget = 64 * 1024 * 1024;
+
+    static string kindLabel(enDiscrepancyKind kind)
+    {
+        switch (kind)
+        {
+        case enDiscrepancyKind::MalformedRecord: return "Malformed Record";
+        case enDiscrepancyKind::BalanceGap: return "Balance Gap";
+        case enDiscrepancyKind::StoreMismatch: return "Store Mismatch";
+        case enDiscrepancyKind::UnknownAccount: return "Unknown Account";
+        }
+        return "";
+    }
+
+    /**
+     * @brief Replays the transfer log and returns every discrepancy, ordered by log offset.
+     *
+     * @param memoryBudget The bytes of movements buffered before they spill to disk.
+     */
+    static stReconciliationSummary reconcile(size_t memoryBudget = defaultMemoryBudget)
+    {
+        clsTraceSpan span("clsLedgerReconciliation::reconcile");
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+        stReconciliationSummary summary;
+
+        error_code error;
+        uint64_t logBytes = filesystem::file_size(TransferLogsFile, error);
+        if (error) logBytes = 0;
+
+        // every log line becomes two movement lines of about half its size.
+        clsThreadPool & pool = clsThreadPool::shared();
+        clsSpillingPartitioner partitioner(TransferLogsFile + ".reconcile",
+            clsSpillingPartitioner::choosePartitionCount(logBytes, memoryBudget, pool.getThreadCount()), memoryBudget);
+
+        try
+        {
+            clsLogScanner::stScanStats stats = clsLogScanner::forEachWithOffsets<_stLedgerTransfer>(TransferLogsFile,
+                [](const string& line, uint64_t offset) { return _parseTransfer(line, offset); },
+                [&](_stLedgerTransfer & transfer)
+                {
+                    if (transfer.malformed)
+                    {
+                        summary.vDiscrepancies.push_back({enDiscrepancyKind::MalformedRecord, "", transfer.offset, 0, 0, 0});
+                        return;
+                    }
+
+                    partitioner.add(transfer.sourceAccount, transfer.debitLine);
+                    partitioner.add(transfer.destinationAccount, transfer.creditLine);
+                }, pool);
+
+            summary.recordsScanned = stats.records;
+        }
+        catch (const exception & e)
+        {
+            summary.error = e.what();
+            return summary;
+        }
+
+        size_t partitionCount = partitioner.getPartitionCount();
+        vector <vector <stLedgerDiscrepancy>> vPartitionDiscrepancies(partitionCount);
+        vector <vector <_stAccountEnd>> vPartitionAccountEnds(partitionCount);
+        atomic <bool> failed(false);
+        mutex errorLock;
+
+        // the balances are copied on this thread: a lookup may reload the client cache, which runs on the
+        // pool itself and must not happen from inside a pool task.
+        unordered_map <string, float> mpClientBalances = _clientBalances();
+
+        pool.parallelFor(partitionCount, [&](size_t partition)
+        {
+            try
+            {
+                _checkPartition(partitioner.takePartition(partition), vPartitionDiscrepancies[partition], vPartitionAccountEnds[partition]);
+                _checkStore(vPartitionAccountEnds[partition], mpClientBalances, vPartitionDiscrepancies[partition]);
+            }
+            catch (const exception & e)
+            {
+                lock_guard <mutex> lock(errorLock);
+                failed = true;
+                summary.error = e.what();
+            }
+        });
+
+        for (size_t partition = 0; partition < partitionCount; partition++)
+        {
+            vector <stLedgerDiscrepancy> & vDiscrepancies = vPartitionDiscrepancies[partition];
+
+            summary.vDiscrepancies.insert(summary.vDiscrepancies.end(), make_move_iterator(vDiscrepancies.begin()),
+                                          make_move_iterator(vDiscrepancies.end()));
+
+            summary.accountsChecked += vPartitionAccountEnds[partition].size();
+        }
+
+        stable_sort(summary.vDiscrepancies.begin(), summary.vDiscrepancies.end(),
+                    [](const stLedgerDiscrepancy & a, const stLedgerDiscrepancy & b) { return a.offset < b.offset; });
+
+        summary.partitionCount = partitionCount;
+        summary.spilledBytes = partitioner.getSpilledBytes();
+        summary.completed = !failed;
+        summary.milliseconds = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+        return summary;
+    }
+
+    /**
+     * @brief Writes the discrepancies of a run as CSV.
+     */
+    static void writeCsv(ostream & out, const stReconciliationSummary & summary)
+    {
+        out << "Kind,Account,Offset,PreviousOffset,Expected,Recorded,Difference\n";
+        out << fixed << setprecision(2);
+
+        for (const stLedgerDiscrepancy & discrepancy : summary.vDiscrepancies)
+        {
+            out << kindLabel(discrepancy.kind) << "," << discrepancy.accountNumber << "," << discrepancy.offset << ",";
+            out << discrepancy.previousOffset << "," << discrepancy.expected << "," << discrepancy.recorded << ",";
+            out << discrepancy.recorded - discrepancy.expected << "\n";
+        }
+        out << defaultfloat;
+    }
+};
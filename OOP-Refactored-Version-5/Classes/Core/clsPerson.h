@@ -10,9 +10,16 @@
  * - Encapsulates personal data fields.
  * - Provides setters and getters for managing personal information.
  * - Offers utility methods such as retrieving the full name.
+ *
+ * ## Notable Implementation Details
+ * - Getters return const references: reading a field never copies it.
+ * - The constructor and the setters take their strings by value and move them into place, so
+ *   passing a temporary costs no copy at all.
  */
 #pragma once
 #include <iostream>
+#include <string>
+#include <utility>
 using namespace std;
 
 /**
@@ -24,7 +31,8 @@ using namespace std;
  * these details and utility to retrieve a full name string.
  *
  * ## Getters
- * All getters are marked as `const`, ensuring they do not modify the object state.
+ * All getters are marked as `const` and return const references, so they neither modify
+ * nor copy the object state.
  */
 class clsPerson
 {
@@ -41,51 +49,48 @@ public:
      * @param phone Phone number of the person.
      */
     clsPerson(string fName, string lName, string email, string phone)
+        : _firstName(move(fName)), _lastName(move(lName)), _email(move(email)), _phone(move(phone))
     {
-        _firstName = fName;
-        _lastName = lName;
-        _email = email;
-        _phone = phone;
     }
 
     /// @brief Sets the first name of the person.
     /// @param name New first name.
     void setFirstName(string name)
     {
-        _firstName = name;
+        _firstName = move(name);
     }
 
     /// @brief Sets the last name of the person.
     /// @param name New last name.
     void setLastName(string name)
     {
-        _lastName = name;
+        _lastName = move(name);
     }
 
     /// @brief Sets the email of the person.
     /// @param email New email address.
     void setEmail(string email)
     {
-        _email = email;
+        _email = move(email);
     }
 
     /// @brief Sets the phone number of the person.
     /// @param phone New phone number.
     void setPhone(string phone)
     {
-        _phone = phone;
+        _phone = move(phone);
     }
 
     /// @brief Retrieves the first name.
-    /// @return First name string.
-    string getFirstName() const
+    /// @return Reference to the first name.
+    const string& getFirstName() const
     {
         return _firstName;
     }
 
     /// @brief Retrieves the last name.
-    /// @return Last name string.
-    string getLastName() const
+    /// @return Reference to the last name.
+    const string& getLastName() const
     {
         return _lastName;
     }
@@ -98,15 +103,15 @@ public:
     }
 
     /// @brief Retrieves the email address.
-    /// @return Email string.
-    string getEmail() const
+    /// @return Reference to the email address.
+    const string& getEmail() const
     {
         return _email;
     }
 
     /// @brief Retrieves the phone number.
-    /// @return Phone number string.
-    string getPhone() const
+    /// @return Reference to the phone number.
+    const string& getPhone() const
     {
         return _phone;
     }
@@ -0,0 +1,385 @@
+/**
+ * @file clsStatementGenerator.h
+ * @brief Declares the `clsStatementGenerator` class, which writes the monthly statement of every account.
+ *
+ * ## Overview
+ * `generateStatements()` turns the transfer log into one statement file per account for a month:
+ * 1. the log is streamed once through `clsLogScanner::forEach()`; every transfer of the month
+ *    becomes two statement lines (a debit for the source account, a credit for the destination),
+ *    handed to a `clsSpillingPartitioner` keyed by account number;
+ * 2. the partitions are then taken back in parallel on the shared `clsThreadPool`; every worker
+ *    groups its partition by account and writes the statements of those accounts.
+ *
+ * Only the current window of the log and the partition buffers (capped by the memory budget,
+ * beyond which they spill to disk) are held in memory, however large the log grows.
+ *
+ * ## Data Storage Format
+ * One file per account with activity in the month, `StatementsFolder/YYYY-MM/<AccountNumber>.txt`,
+ * listing its transfers in log order between the opening and closing balances, then the total
+ * money in and out.
+ *
+ * ## Notable Implementation Details
+ * - Every log line carries the balances after the transfer, so the closing balance of a month is the
+ *   balance after its last transfer. The opening balance is the balance the log left the account
+ *   before the month, from `clsBalanceCheckpoints::balancesAsOf()` (one checkpoint interval is
+ *   replayed, not the whole history); for an account without earlier transfers it is the balance
+ *   after its first transfer of the month minus that transfer.
+ * - Deposits, withdrawals and interest postings are not in the transfer log, so the opening balance
+ *   is the one the last transfer before the month left, and the rows do not show them. Every
+ *   statement prints their net effect as "Other Changes": the closing balance minus the opening
+ *   balance and the transfers of the month (0.00 when the transfers account for everything).
+ * - Accounts without transfers in the month get no statement.
+ * - The client names are copied into an account → name map before the workers start; the workers only
+ *   read that map, never the client cache (a lookup there may reload it on the thread pool).
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <charconv>
+#include <filesystem>
+#include "clsBankClient.h"
+#include "clsBalanceCheckpoints.h"
+#include "clsGlobal.h"
+#include "../Utils/clsLogScanner.h"
+#include "../Utils/clsSpillingPartitioner.h"
+#include "../Utils/clsString.h"
+#include "../Utils/clsThreadPool.h"
+#include "../Utils/clsTracer.h"
+using namespace std;
+
+/**
+ * @struct stStatementRunSummary
+ * @brief The outcome of one statement run.
+ */
+struct stStatementRunSummary
+{
+    bool completed = false;
+    string folder, error;
+    size_t recordsScanned = 0;
+    size_t recordsInPeriod = 0;
+    size_t statementsWritten = 0;
+    size_t partitionCount = 0;
+    size_t spillCount = 0;
+    uint64_t spilledBytes = 0;
+    long long milliseconds = 0;
+};
+
+class clsStatementGenerator
+{
+private:
+    /**
+     * @brief A transfer of the log, as the two statement lines it adds (empty when outside the month).
+     */
+    struct _stStatementTransfer
+    {
+        string sourceAccount, destinationAccount;
+        string debitLine, creditLine;
+    };
+
+    /**
+     * @brief A statement line of a partition: its account and the whole line, both viewing the partition text.
+     */
+    struct _stStatementLine
+    {
+        string_view account, line;
+    };
+
+    static int _parseInt(string_view s)
+    {
+        int value = 0;
+        from_chars(s.data(), s.data() + s.size(), value);
+        return value;
+    }
+
+    /**
+     * @brief Reads the month and year of a `D/M/YYYY - H:M:S` timestamp.
+     */
+    static bool _isInPeriod(string_view timestamp, int month, int year)
+    {
+        string_view arParts[3];
+        if (clsString::splitView(timestamp, arParts, 3, "/") != 3) return false;
+
+        return _parseInt(arParts[1]) == month && _parseInt(arParts[2]) == year;
+    }
+
+    /**
+     * @brief Builds one statement line: `Account#//#Timestamp#//#Type#//#Counterparty#//#Amount#//#BalanceAfter#//#User`.
+     */
+    static string _statementLine(string_view account, string_view timestamp, string_view type, string_view counterparty,
+                                 string_view amount, string_view balanceAfter, string_view userName)
+    {
+        string line;
+        line.reserve(account.size() + timestamp.size() + counterparty.size() + amount.size() + balanceAfter.size() + userName.size() + 32);
+
+        for (string_view field : {account, timestamp, type, counterparty, amount, balanceAfter})
+        {
+            line.append(field);
+            line += "#//#";
+        }
+        line.append(userName);
+
+        return line;
+    }
+
+    static _stStatementTransfer _parseTransfer(const string& line, int month, int year)
+    {
+        _stStatementTransfer transfer;
+        string_view arFields[7];
+
+        if (clsString::splitView(line, arFields, 7, "#//#") != 7 || !_isInPeriod(arFields[0], month, year))
+            return transfer;
+
+        transfer.sourceAccount.assign(arFields[1]);
+        transfer.destinationAccount.assign(arFields[2]);
+        transfer.debitLine = _statementLine(arFields[1], arFields[0], "Out", arFields[2], arFields[3], arFields[4], arFields[6]);
+        transfer.creditLine = _statementLine(arFields[2], arFields[0], "In", arFields[1], arFields[3], arFields[5], arFields[6]);
+
+        return transfer;
+    }
+
+    /**
+     * @brief Maps every account number to its client's full name, on the calling thread.
+     */
+    static unordered_map <string, string> _clientNames()
+    {
+        unordered_map <string, string> mpNames;
+
+        for (const clsBankClient & client : clsRepository<clsBankClient>::open(ClientsDataFile).getAll())
+            mpNames[client.getAccountNumber().str()] = client.getFirstName() + " " + client.getLastName();
+
+        return mpNames;
+    }
+
+    static string _formatAmount(double amount)
+    {
+        ostringstream out;
+        out << fixed << setprecision(2) << amount;
+        return out.str();
+    }
+
+    /**
+     * @brief Writes the statement of one account from its lines, in log order.
+     *
+     * @param clientName The client's full name, empty if the account no longer exists.
+     * @param openingBalance The balance of the account before the month, or nullptr if it had no earlier transfer.
+     */
+    static bool _writeStatement(const string& fileName, const string& accountNumber, const string& clientName, const string& period,
+                                const stAccountBalance * openingBalance, const _stStatementLine * begin, const _stStatementLine * end)
+    {
+        double opening = 0, closing = 0, totalIn = 0, totalOut = 0;
+        ostringstream rows;
+
+        for (const _stStatementLine * entry = begin; entry != end; ++entry)
+        {
+            string_view arFields[7];
+            clsString::splitView(entry->line, arFields, 7, "#//#");
+
+            bool isCredit = arFields[2] == "In";
+            double amount = clsString::parseDouble(arFields[4]);
+            double balanceAfter = clsString::parseDouble(arFields[5]);
+
+            if (entry == begin)
+                opening = openingBalance ? openingBalance->balance : balanceAfter + (isCredit ? -amount : amount);
+            closing = balanceAfter;
+            (isCredit ? totalIn : totalOut) += amount;
+
+            rows << "| " << left << setw(22) << arFields[1];
+            rows << "| " << left << setw(5) << arFields[2];
+            rows << "| " << left << setw(14) << arFields[3];
+            rows << "| " << right << setw(14) << _formatAmount(isCredit ? amount : -amount) << " ";
+            rows << "| " << right << setw(14) << _formatAmount(balanceAfter) << " ";
+            rows << "| " << left << setw(12) << arFields[6] << "|\n";
+        }
+
+        double expectedClosing = opening + totalIn - totalOut;
+        double otherChanges = clsBalanceCheckpoints::sameBalance(closing, expectedClosing) ? 0 : closing - expectedClosing;
+
+        string line(95, '-');
+
+        ostringstream statement;
+        statement << "Statement of Account : " << accountNumber << "\n";
+        statement << "Client Name          : " << clientName << "\n";
+        statement << "Period               : " << period << "\n";
+        statement << "Opening Balance      : " << _formatAmount(opening) << "\n\n";
+        statement << line << "\n";
+        statement << "| " << left << setw(22) << "Date/Time";
+        statement << "| " << left << setw(5) << "Type";
+        statement << "| " << left << setw(14) << "Counterparty";
+        statement << "| " << left << setw(15) << "Amount";
+        statement << "| " << left << setw(15) << "Balance After";
+        statement << "| " << left << setw(12) << "User" << "|\n";
+        statement << line << "\n";
+        statement << rows.str();
+        statement << line << "\n\n";
+        statement << "Transfers            : " << (end - begin) << "\n";
+        statement << "Total In             : " << _formatAmount(totalIn) << "\n";
+        statement << "Total Out            : " << _formatAmount(totalOut) << "\n";
+        statement << "Other Changes        : " << _formatAmount(otherChanges) << " (deposits, withdrawals and interest, not itemized)\n";
+        statement << "Closing Balance      : " << _formatAmount(closing) << "\n";
+
+        fstream myFile;
+        myFile.open(fileName, ios::out | ios::binary);
+        if (!myFile.is_open()) return false;
+
+        string text = statement.str();
+        myFile.write(text.data(), text.size());
+        myFile.close();
+
+        return !myFile.fail();
+    }
+
+    /**
+     * @brief Groups one partition by account and writes the statements of its accounts.
+     * @param vOpeningBalances The balances before the month, ordered by account number.
+     * @param mpClientNames The client names by account number (see `_clientNames()`).
+     * @return The number of statements written.
+     */
+    static size_t _writePartitionStatements(const string& lines, const string& folder, const string& period,
+                                            const vector <stAccountBalance> & vOpeningBalances,
+                                            const unordered_map <string, string> & mpClientNames)
+    {
+        vector <_stStatementLine> vEntries;
+
+        size_t begin = 0;
+        while (begin < lines.size())
+        {
+            size_t lineEnd = lines.find('\n', begin);
+            if (lineEnd == string::npos) lineEnd = lines.size();
+
+            string_view line(lines.data() + begin, lineEnd - begin);
+            vEntries.push_back({line.substr(0, line.find("#//#")), line});
+
+            begin = lineEnd + 1;
+        }
+
+        // stable: the lines of an account stay in log order.
+        stable_sort(vEntries.begin(), vEntries.end(),
+                    [](const _stStatementLine & a, const _stStatementLine & b) { return a.account < b.account; });
+
+        size_t written = 0;
+        for (size_t first = 0; first < vEntries.size();)
+        {
+            size_t last = first;
+            while (last < vEntries.size() && vEntries[last].account == vEntries[first].account)
+                last++;
+
+            string accountNumber(vEntries[first].account);
+
+            auto opening = lower_bound(vOpeningBalances.begin(), vOpeningBalances.end(), accountNumber,
+                                       [](const stAccountBalance & balance, const string& account) { return balance.accountNumber < account; });
+            bool hasOpening = opening != vOpeningBalances.end() && opening->accountNumber == accountNumber;
+
+            auto name = mpClientNames.find(accountNumber);
+
+            if (_writeStatement(folder + "/" + accountNumber + ".txt", accountNumber, name != mpClientNames.end() ? name->second : string(),
+                                period, hasOpening ? &*opening : nullptr, vEntries.data() + first, vEntries.data() + last))
+                written++;
+
+            first = last;
+        }
+        return written;
+    }
+
+public:
+    static const size_t defaultMemoryBudget = 64 * 1024 * 1024;
+
+    /**
+     * @brief Writes the statement of every account with transfers in the given month.
+     *
+     * @param month The month, 1 to 12.
+     * @param year The year, e.g. 2026.
+     * @param memoryBudget The bytes of statement lines buffered before they spill to disk.
+     */
+    static stStatementRunSummary generateStatements(int month, int year, size_t memoryBudget = defaultMemoryBudget)
+    {
+        clsTraceSpan span("clsStatementGenerator::generateStatements");
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+        stStatementRunSummary summary;
+
+        string period = to_string(year) + "-" + (month < 10 ? "0" : "") + to_string(month);
+        summary.folder = StatementsFolder + "/" + period;
+
+        error_code error;
+        filesystem::create_directories(summary.folder, error);
+        if (error)
+        {
+            summary.error = "Could not create the folder [" + summary.folder + "]";
+            return summary;
+        }
+
+        // every log line becomes two statement lines of about its size.
+        clsThreadPool & pool = clsThreadPool::shared();
+        uint64_t logBytes = filesystem::file_size(TransferLogsFile, error);
+        if (error) logBytes = 0;
+
+        clsSpillingPartitioner partitioner(summary.folder + "/.spill",
+            clsSpillingPartitioner::choosePartitionCount(logBytes * 2, memoryBudget, pool.getThreadCount()), memoryBudget);
+
+        try
+        {
+            clsLogScanner::stScanStats stats = clsLogScanner::forEach<_stStatementTransfer>(TransferLogsFile,
+                [month, year](const string& line) { return _parseTransfer(line, month, year); },
+                [&](_stStatementTransfer & transfer)
+                {
+                    if (transfer.debitLine.empty()) return;
+
+                    summary.recordsInPeriod++;
+                    partitioner.add(transfer.sourceAccount, transfer.debitLine);
+                    partitioner.add(transfer.destinationAccount, transfer.creditLine);
+                }, pool);
+
+            summary.recordsScanned = stats.records;
+        }
+        catch (const exception & e)
+        {
+            summary.error = e.what();
+            return summary;
+        }
+
+        atomic <size_t> written(0);
+        atomic <bool> failed(false);
+        mutex errorLock;
+
+        // the balances left by every transfer before the first second of the month.
+        int64_t monthStartKey = ((int64_t)year * 10000 + month * 100 + 1) * 1000000;
+        vector <stAccountBalance> vOpeningBalances = clsBalanceCheckpoints::balancesAsOf(monthStartKey - 1);
+
+        // the names are read from the client cache on this thread: a lookup may reload the cache, which
+        // runs on the pool itself and must not happen from inside a pool task.
+        unordered_map <string, string> mpClientNames = _clientNames();
+
+        pool.parallelFor(partitioner.getPartitionCount(), [&](size_t partition)
+        {
+            try
+            {
+                written += _writePartitionStatements(partitioner.takePartition(partition), summary.folder, period, vOpeningBalances, mpClientNames);
+            }
+            catch (const exception & e)
+            {
+                lock_guard <mutex> lock(errorLock);
+                failed = true;
+                summary.error = e.what();
+            }
+        });
+
+        summary.statementsWritten = written;
+        summary.partitionCount = partitioner.getPartitionCount();
+        summary.spillCount = partitioner.getSpillCount();
+        summary.spilledBytes = partitioner.getSpilledBytes();
+        summary.completed = !failed;
+        summary.milliseconds = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+        return summary;
+    }
+};
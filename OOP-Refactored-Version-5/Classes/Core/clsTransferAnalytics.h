@@ -0,0 +1,383 @@
+/**
+ * @file clsTransferAnalytics.h
+ * @brief Declares the `clsTransferAnalytics` class, a small group-by engine over the transfer log.
+ *
+ * ## Overview
+ * A `stTransferQuery` names a filter (`stTransferFilter`), the fields to group by (`enTransferGroupKey`)
+ * and how many of the largest transfers of every group to keep. `run()` answers it in one pass
+ * over the log, giving every group its transfer count and the sum, smallest and largest amount:
+ * - the log is folded with `clsLogScanner::aggregate()`: every pool worker parses its ranges with
+ *   `clsTransferRecord::parseTransferRecordView()` (views of the line, no `clsTransferRecord` is built)
+ *   and adds them to its own hash table of groups;
+ * - the tables are merged on the calling thread and the groups ordered by key.
+ *
+ * The reports Operations asks for are ready-made queries: `tellerHourlyActivity()`,
+ * `accountDailyVolume()` and `largestTransfersPerDay()`.
+ *
+ * ## Data Storage Format
+ * `writeCsv()` exports a result with one column per group key, then `Count,Sum,Min,Max`; with a
+ * top-K, every group has one row per kept transfer, with its rank, time, accounts, teller and amount.
+ *
+ * ## Notable Implementation Details
+ * - Days and hours are keyed as `YYYY-MM-DD` and `YYYY-MM-DD HH:00`, so the groups order by time.
+ * - Grouping by `Account` counts a transfer for both its accounts; with an account filter, only
+ *   for the filtered one.
+ * - Equal amounts in a top-K are ranked by log position, so the result does not depend on how the
+ *   log was split between the workers.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <cstdint>
+#include "clsEnums.h"
+#include "clsGlobal.h"
+#include "../Screens/Transactions/clsTransferRecord.h"
+#include "../Utils/clsDate.h"
+#include "../Utils/clsLogScanner.h"
+#include "../Utils/clsTracer.h"
+using namespace std;
+
+/**
+ * @struct stTransferFilter
+ * @brief The transfers a query reads; empty fields match every transfer.
+ *
+ * `fromKey` and `toKey` are inclusive `clsDate::timestampKey()` bounds; `account` matches either account.
+ */
+struct stTransferFilter
+{
+    int64_t fromKey = 0;
+    int64_t toKey = numeric_limits<int64_t>::max();
+    string teller, account;
+    double minAmount = 0;
+};
+
+/**
+ * @struct stTransferQuery
+ * @brief A filter, the fields to group by (none for a single group) and the top-K size (0 for none).
+ */
+struct stTransferQuery
+{
+    stTransferFilter filter;
+    vector <enTransferGroupKey> vGroupBy;
+    size_t topK = 0;
+};
+
+/**
+ * @struct stTopTransfer
+ * @brief One of the largest transfers of a group.
+ */
+struct stTopTransfer
+{
+    uint64_t offset = 0;
+    double amount = 0;
+    string timestamp, sourceAccount, destinationAccount, teller;
+};
+
+/**
+ * @struct stTransferGroup
+ * @brief The aggregates of one group; `vKey` holds one value per group key of the query.
+ */
+struct stTransferGroup
+{
+    vector <string> vKey;
+    size_t count = 0;
+    double sum = 0;
+    double min = numeric_limits<double>::max();
+    double max = numeric_limits<double>::lowest();
+    vector <stTopTransfer> vTop;
+};
+
+/**
+ * @struct stTransferAnalyticsResult
+ * @brief The groups of a query, ordered by key, and what the scan read.
+ */
+struct stTransferAnalyticsResult
+{
+    vector <stTransferGroup> vGroups;
+    size_t recordsScanned = 0;
+    size_t recordsMatched = 0;
+    size_t malformedRecords = 0;
+    long long milliseconds = 0;
+};
+
+class clsTransferAnalytics
+{
+private:
+    /**
+     * @brief The groups one worker has folded so far.
+     */
+    struct _stPartial
+    {
+        unordered_map <string, stTransferGroup> mpGroups;
+        size_t matched = 0, malformed = 0;
+        string key;
+    };
+
+    static const char _keySeparator = '\x1f';
+
+    static void _appendDigits(string & out, int64_t value, int width)
+    {
+        char buffer[20];
+        for (int digit = width - 1; digit >= 0; digit--, value /= 10)
+            buffer[digit] = char('0' + value % 10);
+        out.append(buffer, width);
+    }
+
+    static void _appendDay(string & out, int64_t timestampKey)
+    {
+        int64_t date = timestampKey / 1000000;
+
+        _appendDigits(out, date / 10000, 4);
+        out += '-';
+        _appendDigits(out, date / 100 % 100, 2);
+        out += '-';
+        _appendDigits(out, date % 100, 2);
+    }
+
+    static void _appendKeyPart(string & key, enTransferGroupKey groupKey, const stTransferRecordView & record,
+                               int64_t timestampKey, string_view account)
+    {
+        switch (groupKey)
+        {
+        case enTransferGroupKey::Teller: key.append(record.userName); break;
+        case enTransferGroupKey::SourceAccount: key.append(record.sourceAccountNumber); break;
+        case enTransferGroupKey::DestinationAccount: key.append(record.destinationAccountNumber); break;
+        case enTransferGroupKey::Account: key.append(account); break;
+        case enTransferGroupKey::Day: _appendDay(key, timestampKey); break;
+        case enTransferGroupKey::Hour:
+            _appendDay(key, timestampKey);
+            key += ' ';
+            _appendDigits(key, timestampKey / 10000 % 100, 2);
+            key += ":00";
+            break;
+        }
+    }
+
+    static bool _isLarger(const stTopTransfer & a, const stTopTransfer & b)
+    {
+        return a.amount > b.amount || (a.amount == b.amount && a.offset < b.offset);
+    }
+
+    /**
+     * @brief Keeps `transfer` if it is among the `topK` largest; `vTop` is a heap with the smallest kept transfer on top.
+     */
+    static void _offerTop(vector <stTopTransfer> & vTop, size_t topK, stTopTransfer && transfer)
+    {
+        if (vTop.size() < topK)
+        {
+            vTop.push_back(move(transfer));
+            push_heap(vTop.begin(), vTop.end(), _isLarger);
+        }
+        else if (_isLarger(transfer, vTop.front()))
+        {
+            pop_heap(vTop.begin(), vTop.end(), _isLarger);
+            vTop.back() = move(transfer);
+            push_heap(vTop.begin(), vTop.end(), _isLarger);
+        }
+    }
+
+    static bool _matches(const stTransferFilter & filter, const stTransferRecordView & record, int64_t timestampKey)
+    {
+        return timestampKey >= filter.fromKey && timestampKey <= filter.toKey && record.amount >= filter.minAmount &&
+               (filter.teller.empty() || record.userName == filter.teller) &&
+               (filter.account.empty() || record.sourceAccountNumber == filter.account || record.destinationAccountNumber == filter.account);
+    }
+
+    static void _accumulate(const stTransferQuery & query, _stPartial & partial, string_view line, uint64_t offset)
+    {
+        stTransferRecordView record = clsTransferRecord::parseTransferRecordView(line);
+
+        if (record.sourceAccountNumber.empty())
+        {
+            partial.malformed++;
+            return;
+        }
+
+        int64_t timestampKey = clsDate::timestampKey(record.loginTimeRecord);
+        if (!_matches(query.filter, record, timestampKey)) return;
+
+        partial.matched++;
+
+        // grouped by account, a transfer counts for each of its two accounts.
+        bool byAccount = find(query.vGroupBy.begin(), query.vGroupBy.end(), enTransferGroupKey::Account) != query.vGroupBy.end();
+
+        for (string_view account : {record.sourceAccountNumber, record.destinationAccountNumber})
+        {
+            if (byAccount && !query.filter.account.empty() && account != query.filter.account) continue;
+
+            partial.key.clear();
+            for (size_t part = 0; part < query.vGroupBy.size(); part++)
+            {
+                if (part > 0) partial.key += _keySeparator;
+                _appendKeyPart(partial.key, query.vGroupBy[part], record, timestampKey, account);
+            }
+
+            stTransferGroup & group = partial.mpGroups[partial.key];
+            group.count++;
+            group.sum += record.amount;
+            group.min = min<double>(group.min, record.amount);
+            group.max = max<double>(group.max, record.amount);
+
+            if (query.topK > 0 && (group.vTop.size() < query.topK || record.amount >= group.vTop.front().amount))
+            {
+                _offerTop(group.vTop, query.topK, {offset, record.amount, string(record.loginTimeRecord), string(record.sourceAccountNumber),
+                                                   string(record.destinationAccountNumber), string(record.userName)});
+            }
+
+            if (!byAccount) break;
+        }
+    }
+
+    static void _merge(const stTransferQuery & query, _stPartial & total, _stPartial & partial)
+    {
+        total.matched += partial.matched;
+        total.malformed += partial.malformed;
+
+        for (auto & [key, group] : partial.mpGroups)
+        {
+            auto found = total.mpGroups.find(key);
+            if (found == total.mpGroups.end())
+            {
+                total.mpGroups.emplace(key, move(group));
+                continue;
+            }
+
+            stTransferGroup & totalGroup = found->second;
+            totalGroup.count += group.count;
+            totalGroup.sum += group.sum;
+            totalGroup.min = min(totalGroup.min, group.min);
+            totalGroup.max = max(totalGroup.max, group.max);
+
+            for (stTopTransfer & transfer : group.vTop)
+                _offerTop(totalGroup.vTop, query.topK, move(transfer));
+        }
+        partial.mpGroups.clear();
+    }
+
+public:
+    /**
+     * @brief Runs a query over the transfer log.
+     */
+    static stTransferAnalyticsResult run(const stTransferQuery & query, const string& fileName = TransferLogsFile)
+    {
+        clsTraceSpan span("clsTransferAnalytics::run");
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+        stTransferAnalyticsResult result;
+        clsLogScanner::stScanStats stats;
+
+        _stPartial total = clsLogScanner::aggregate<_stPartial>(fileName,
+            [&query](_stPartial & partial, string_view line, uint64_t offset) { _accumulate(query, partial, line, offset); },
+            [&query](_stPartial & total, _stPartial & partial) { _merge(query, total, partial); }, &stats);
+
+        vector <pair <string, stTransferGroup>> vKeyedGroups(make_move_iterator(total.mpGroups.begin()), make_move_iterator(total.mpGroups.end()));
+        sort(vKeyedGroups.begin(), vKeyedGroups.end(),
+             [](const pair <string, stTransferGroup> & a, const pair <string, stTransferGroup> & b) { return a.first < b.first; });
+
+        result.vGroups.reserve(vKeyedGroups.size());
+        for (auto & [key, group] : vKeyedGroups)
+        {
+            // split by hand: an empty part (e.g. a record without teller) still takes its column.
+            for (size_t begin = 0, part = 0; part < query.vGroupBy.size(); part++)
+            {
+                size_t end = min(key.find(_keySeparator, begin), key.size());
+                group.vKey.push_back(key.substr(begin, end - begin));
+                begin = end + 1;
+            }
+            sort(group.vTop.begin(), group.vTop.end(), _isLarger);
+
+            result.vGroups.push_back(move(group));
+        }
+
+        result.recordsScanned = stats.records;
+        result.recordsMatched = total.matched;
+        result.malformedRecords = total.malformed;
+        result.milliseconds = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+        return result;
+    }
+
+    /**
+     * @brief Transfers per teller per hour.
+     */
+    static stTransferQuery tellerHourlyActivity()
+    {
+        stTransferQuery query;
+        query.vGroupBy = {enTransferGroupKey::Teller, enTransferGroupKey::Hour};
+        return query;
+    }
+
+    /**
+     * @brief The money moved through every account each day, in and out.
+     */
+    static stTransferQuery accountDailyVolume()
+    {
+        stTransferQuery query;
+        query.vGroupBy = {enTransferGroupKey::Account, enTransferGroupKey::Day};
+        return query;
+    }
+
+    /**
+     * @brief The `topK` largest transfers of every day.
+     */
+    static stTransferQuery largestTransfersPerDay(size_t topK = 5)
+    {
+        stTransferQuery query;
+        query.vGroupBy = {enTransferGroupKey::Day};
+        query.topK = topK;
+        return query;
+    }
+
+    static string groupKeyLabel(enTransferGroupKey groupKey)
+    {
+        switch (groupKey)
+        {
+        case enTransferGroupKey::Teller: return "Teller";
+        case enTransferGroupKey::SourceAccount: return "Source";
+        case enTransferGroupKey::DestinationAccount: return "Destination";
+        case enTransferGroupKey::Account: return "Account";
+        case enTransferGroupKey::Day: return "Day";
+        case enTransferGroupKey::Hour: return "Hour";
+        }
+        return "";
+    }
+
+    /**
+     * @brief Writes the groups of a result as CSV.
+     */
+    static void writeCsv(ostream & out, const stTransferQuery & query, const stTransferAnalyticsResult & result)
+    {
+        for (enTransferGroupKey groupKey : query.vGroupBy)
+            out << groupKeyLabel(groupKey) << ",";
+        out << "Count,Sum,Min,Max";
+        if (query.topK > 0) out << ",Rank,Timestamp,Source,Destination,Teller,Amount";
+        out << "\n";
+
+        out << fixed << setprecision(2);
+        for (const stTransferGroup & group : result.vGroups)
+        {
+            for (size_t rank = 0; rank < max<size_t>(1, group.vTop.size()); rank++)
+            {
+                for (const string& part : group.vKey)
+                    out << part << ",";
+                out << group.count << "," << group.sum << "," << group.min << "," << group.max;
+
+                if (rank < group.vTop.size())
+                {
+                    const stTopTransfer & transfer = group.vTop[rank];
+                    out << "," << rank + 1 << "," << transfer.timestamp << "," << transfer.sourceAccount << ",";
+                    out << transfer.destinationAccount << "," << transfer.teller << "," << transfer.amount;
+                }
+                out << "\n";
+            }
+        }
+        out << defaultfloat;
+    }
+};
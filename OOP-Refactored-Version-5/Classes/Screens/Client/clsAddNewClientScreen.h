@@ -87,13 +87,14 @@ public:
         // note: New implementation with 'template' integrated in the method.
         addNewEntityScreen
         (
-            UsersDataFile,
-            "\tAdd New User Info Scree",
+            ClientsDataFile,
+            "\tAdd New Client Info Screen",
             "\nClient Added Successfully.",
+            "\nAdd Failed, This Account Number Was Added Meanwhile.",
             clsBankClient::readAccountNumber,
             clsBankClient::_getAddClientObject,
             clsBankClient::_changeClientRecord,
-            clsBankClient::_saveClientDataIntoFile,
+            clsBankClient::addClientRecord,
             clsPrintPersonCard::printClientInfo
         );
 
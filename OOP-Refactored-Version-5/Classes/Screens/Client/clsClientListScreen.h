@@ -14,6 +14,8 @@
  * - Print client details (account number, PIN code, full name, phone, email, and balance)
  *   in a tabular format with proper column alignment.
  * - Handle the case when no client data exists in the system.
+ * - Order the list on request: file order, by name, by account number, or the top K balances,
+ *   and print it page by page.
  *
  * ## Relationships
  * - **Inherits from:** `clsScreen` — for drawing screen headers and providing
@@ -23,11 +25,17 @@
  *   - Standard C++ I/O and formatting utilities (`iostream`, `iomanip`) for aligned output.
  *
  * ## Notable Implementation Details
- * - Client records are retrieved using `clsBankClient::getListVectorFromFile()`,
- *   which loads clients from the persistent storage file.
+ * - Client records are retrieved using `clsBankClient::getClientViews()`, which copies
+ *   the cached clients into a screen-local `clsArena`; the arena is released in one go on return.
  * - `_printClientData()` is a helper method responsible for printing a single
  *   client’s details in a row with aligned columns.
  * - The table uses fixed-width columns with `setw` for consistent alignment.
+ * - Sorting never moves the client views: `clsParallelOrder` returns a permutation of their
+ *   positions (a parallel chunked sort and merge), and the rows are printed through it. Account
+ *   numbers are compared as packed `clsAccountKey`s, computed once per client.
+ * - "Top balances" keeps a bounded heap per worker in a single pass (`clsParallelOrder::topK()`),
+ *   so asking for the top 100 of millions of clients sorts only the per-worker winners.
+ * - Rows are printed `_pageSize` at a time; the teller is asked before every further page.
  * - If no clients exist, the screen explicitly shows a message instead of an empty table.
  *
  * ## Usage
@@ -40,6 +48,10 @@
 #include <iomanip>
 #include "../Misc/clsScreen.h"
 #include "../../Core/clsBankClient.h"
+#include "../../Core/clsAccountKey.h"
+#include "../../Utils/clsParallelOrder.h"
+#include "../../Utils/clsInputValidation.h"
+#include "../../Utils/clsUtil.h"
 using namespace std;
 
 /**
@@ -65,25 +77,79 @@ using namespace std;
 class clsClientListScreen : protected clsScreen
 {
 private:
-    static void _printClientData(clsBankClient clientData)
+    static const size_t _pageSize = 25;
+
+    enum class enListOrder
+    {
+        FileOrder = 1,
+        ByName = 2,
+        ByAccountNumber = 3,
+        TopBalances = 4,
+    };
+
+    static enListOrder _readListOrder()
     {
-        cout << setw(8) << left << "" << "| " << setw(17) << left << clientData.getAccountNumber();
-        cout << "| " << setw(15) << left << clientData.getPinCode();
-        cout << "| " << setw(20) << left << clientData.FullName();
-        cout << "| " << setw(15) << left << clientData.getPhone();
-        cout << "| " << setw(25) << left << clientData.getEmail();
-        cout << "| " << setw(9) << left << clientData.getAccountBalance() << "|";
+        cout << "\nList Order: [1] File Order  [2] By Name  [3] By Account Number  [4] Top Balances? ";
+        return (enListOrder)clsInputValidation::readShortNumberBetween(1, 4, "Enter a Number from 1 to 4: ");
     }
 
-public:
-    static void showClientsList()
+    /**
+     * @brief Returns the positions of the clients to print, in the order to print them.
+     */
+    static vector <uint32_t> _orderClients(const clsArenaVector <stClientView> & vClients, enListOrder order, string & orderTitle)
     {
-        vector<clsBankClient> vClients = clsBankClient::getListVectorFromFile(ClientsDataFile);
+        switch (order)
+        {
+            case enListOrder::ByName:
+            {
+                orderTitle = "Sorted By Name";
+                return clsParallelOrder::sortedPermutation(vClients.size(), [&vClients](uint32_t a, uint32_t b)
+                {
+                    const stClientView & clientA = vClients[a], & clientB = vClients[b];
+                    return clientA.firstName != clientB.firstName ? clientA.firstName < clientB.firstName : clientA.lastName < clientB.lastName;
+                });
+            }
+            case enListOrder::ByAccountNumber:
+            {
+                orderTitle = "Sorted By Account Number";
 
-        string title = "\t\tClients List Screen";
-        string subTitle = "\t\tClients List (" + to_string(vClients.size()) + "):";
-        _drawScreenHeader(title, subTitle);
+                // pack every account number once; the sort then compares integers.
+                vector <clsAccountKey> vKeys(vClients.size());
+                size_t chunkCount = min(clsThreadPool::shared().getThreadCount(), max<size_t>(1, vClients.size() / 16384));
 
+                clsThreadPool::shared().parallelFor(chunkCount, [&](size_t chunk)
+                {
+                    size_t begin = vClients.size() * chunk / chunkCount, end = vClients.size() * (chunk + 1) / chunkCount;
+                    for (size_t i = begin; i < end; i++)
+                        vKeys[i] = clsAccountKey(vClients[i].accountNumber);
+                });
+
+                return clsParallelOrder::sortedPermutation(vClients.size(), [&vKeys](uint32_t a, uint32_t b) { return vKeys[a] < vKeys[b]; });
+            }
+            case enListOrder::TopBalances:
+            {
+                cout << "How many clients? ";
+                size_t k = (size_t)clsInputValidation::readShortNumberBetween(1, 10000, "Enter a Number from 1 to 10000: ");
+
+                orderTitle = "Top " + to_string(k) + " Balances";
+                return clsParallelOrder::topK(vClients.size(), k, [&vClients](uint32_t a, uint32_t b)
+                {
+                    return vClients[a].accountBalance > vClients[b].accountBalance;
+                });
+            }
+            default:
+            {
+                orderTitle = "File Order";
+
+                vector <uint32_t> vOrder(vClients.size());
+                for (size_t i = 0; i < vOrder.size(); i++) vOrder[i] = (uint32_t)i;
+                return vOrder;
+            }
+        }
+    }
+
+    static void _printTableHeader()
+    {
         cout << setw(8) << left << "" << "------------------------------------------------------------------------------------------------------------------" << endl;
         cout << setw(8) << left << "" << "| " << left << setw(17) << "Account Number:";
         cout << "| " << left << setw(15) << "PIN Code:";
@@ -92,17 +158,59 @@ public:
         cout << "| " << left << setw(25) << "Email:";
         cout << "| " << left << setw(13) << "Balance: |" << endl;
         cout << setw(8) << left << "" << "------------------------------------------------------------------------------------------------------------------" << endl;
+    }
+
+    static void _printClientData(const stClientView & clientData)
+    {
+        cout << setw(8) << left << "" << "| " << setw(17) << left << clientData.accountNumber;
+        cout << "| " << setw(15) << left << clientData.pinCode;
+        // "first last" padded to 20 columns, without building the full name string.
+        cout << "| " << clientData.firstName << ' ' << setw(19 - (int)clientData.firstName.size()) << left << clientData.lastName;
+        cout << "| " << setw(15) << left << clientData.phone;
+        cout << "| " << setw(25) << left << clientData.email;
+        cout << "| " << setw(9) << left << (float)clientData.accountBalance << "|";
+    }
+
+public:
+    static void showClientsList()
+    {
+        clsArena arena;
+        clsArenaVector <stClientView> vClients = clsBankClient::getClientViews(ClientsDataFile, arena);
+
+        string orderTitle;
+        vector <uint32_t> vOrder = _orderClients(vClients, _readListOrder(), orderTitle);
+
+        string title = "\t\tClients List Screen";
+        string subTitle = "\t\tClients List (" + to_string(vClients.size()) + "), " + orderTitle + ":";
+        _drawScreenHeader(title, subTitle);
+
+        _printTableHeader();
 
         if (vClients.size() == 0)
         {
             cout << "\t\t\tNo Data Available in the System" << endl;
         }
 
-        for (clsBankClient &client : vClients)
+        size_t pageCount = (vOrder.size() + _pageSize - 1) / _pageSize;
+
+        for (size_t page = 0; page < pageCount; page++)
         {
-            _printClientData(client);
-            cout << endl;
+            if (page > 0)
+            {
+                char ans = clsUtil::confirm("Page " + to_string(page) + " of " + to_string(pageCount) + ". Show the next page (Y/N)? ");
+                if (tolower(ans) != 'y') break;
+
+                cout << "\n";
+                _printTableHeader();
+            }
+
+            size_t end = min(vOrder.size(), (page + 1) * _pageSize);
+            for (size_t i = page * _pageSize; i < end; i++)
+            {
+                _printClientData(vClients[vOrder[i]]);
+                cout << endl;
+            }
+            cout << setw(8) << left << "" << "------------------------------------------------------------------------------------------------------------------" << endl;
         }
-        cout << setw(8) << left << "" << "------------------------------------------------------------------------------------------------------------------" << endl;
     }
 };
@@ -12,7 +12,7 @@
  * - Display a screen for deleting a client’s information.
  * - Prompt the user to enter an existing account number.
  * - Confirm deletion by showing the client’s details and asking for user confirmation.
- * - Mark the client as deleted and save the updated client list to persistent storage.
+ * - Mark a copy of the client as deleted and save only that deletion to persistent storage.
  * - Provide feedback about the deletion outcome.
  *
  * ## Relationships
@@ -24,7 +24,7 @@
  *
  * ## Notable Implementation Details
  * - Clients are deleted logically by marking them with a delete flag,
- *   then saving the updated list back to file.
+ *   then persisting only that deletion to file.
  * - Confirmation is explicitly requested before any deletion takes place.
  * - If deletion is confirmed, the client object reference is replaced with an empty object.
  *
@@ -70,20 +70,18 @@ public:
      * - Prompts the user to enter an existing account number.
      * - Retrieves and displays the client’s details for confirmation.
      * - Asks the user to confirm whether to proceed with deletion.
-     * - If confirmed, marks the client for deletion and saves the updated list to file.
+     * - If confirmed, marks the client for deletion and persists only that deletion to file.
      * - Replaces the deleted client object with an empty placeholder.
      *
      * @note This method modifies client records and updates persistent storage.
      */
     static void deleteClientScreen()
     {
-        vector<clsBankClient> vClients = clsBankClient::getListVectorFromFile(ClientsDataFile);
-
         _drawScreenHeader("\t Delete Client Info Screen");
 
         string accountNumber = clsBankClient::readAccountNumber(enStatus::Exist);
 
-        clsBankClient &clientToBeDeleted = clsBankClient::findClientRef(accountNumber, vClients);
+        clsBankClient clientToBeDeleted = clsBankClient::findClient(accountNumber);
 
         clsPrintPersonCard::printClientInfo(clientToBeDeleted);
 
@@ -93,8 +91,8 @@ public:
 
         if (tolower(ans) == 'y')
         {
-            clsBankClient::_markClientDeleteSign(clientToBeDeleted, vClients);
-            clsBankClient::_saveClientDataIntoFile(ClientsDataFile, vClients);
+            clientToBeDeleted.setDeleteSign(true);
+            clsBankClient::saveClientRecord(ClientsDataFile, clientToBeDeleted);
             clientToBeDeleted = clsBankClient::_getEmptyClientObject();
             cout << "\nClient Deleted Successfully." << endl;
         }
@@ -0,0 +1,99 @@
+/**
+ * @file clsFindClientByNameScreen.h
+ * @brief Defines the `clsFindClientByNameScreen` class, which finds clients by any part of their name.
+ *
+ * ## Overview
+ * When a customer does not know their account number, the teller types any part of the
+ * customer's name (first letters of the first or last name, or a fragment from the middle) and
+ * this screen lists the best matching clients, ranked by how well their name matches.
+ *
+ * ## Relationships
+ * - **Inherits from:** `clsScreen` — for drawing the screen header.
+ * - **Uses:** `clsBankClient::findClientsByName()` for the ranked search, and
+ *   `clsBankClient::findClient()` to print the phone and balance of every match.
+ *
+ * ## Notable Implementation Details
+ * - The search runs on `clsNameSearchIndex`, so it answers in milliseconds even on millions of
+ *   clients; the time taken is printed under the table.
+ * - At most `_maxResults` matches are listed; a more specific query narrows them down.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include "../Misc/clsScreen.h"
+#include "../../Core/clsBankClient.h"
+#include "../../Utils/clsInputValidation.h"
+using namespace std;
+
+/**
+ * @class clsFindClientByNameScreen
+ * @brief Screen listing the clients whose name starts with or contains the typed text.
+ */
+class clsFindClientByNameScreen : protected clsScreen
+{
+private:
+    static const size_t _maxResults = 20;
+
+    static string _matchLabel(int score)
+    {
+        switch (score)
+        {
+            case 4: return "Full Name";
+            case 3: return "Name";
+            case 2: return "Starts With";
+            default: return "Contains";
+        }
+    }
+
+    static void _printMatch(size_t rank, const stNameMatch & match)
+    {
+        const clsBankClient & client = clsBankClient::findClient(match.id);
+
+        cout << setw(8) << left << "" << "| " << setw(6) << left << rank;
+        cout << "| " << setw(17) << left << client.getAccountNumber();
+        cout << "| " << client.getFirstName() << ' ' << setw(24 - (int)client.getFirstName().size()) << left << client.getLastName();
+        cout << "| " << setw(15) << left << client.getPhone();
+        cout << "| " << setw(12) << left << client.getAccountBalance();
+        cout << "| " << setw(12) << left << _matchLabel(match.score) << "|";
+    }
+
+public:
+    /**
+     * @brief Reads a name query and prints the ranked matching clients.
+     */
+    static void findClientByNameScreen()
+    {
+        _drawScreenHeader("\t Find Client By Name Screen");
+
+        cout << "\nEnter any part of the client's name: ";
+        string query = clsInputValidation::readString();
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        vector <stNameMatch> vMatches = clsBankClient::findClientsByName(query, _maxResults);
+        long long microseconds = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+        cout << "\n" << setw(8) << left << "" << "---------------------------------------------------------------------------------------------------" << endl;
+        cout << setw(8) << left << "" << "| " << left << setw(6) << "Rank:";
+        cout << "| " << left << setw(17) << "Account Number:";
+        cout << "| " << left << setw(25) << "Client Name:";
+        cout << "| " << left << setw(15) << "Phone:";
+        cout << "| " << left << setw(12) << "Balance:";
+        cout << "| " << left << setw(12) << "Match:" << "|" << endl;
+        cout << setw(8) << left << "" << "---------------------------------------------------------------------------------------------------" << endl;
+
+        if (vMatches.empty())
+        {
+            cout << "\t\t\tNo Client Matches [" << query << "]" << endl;
+        }
+
+        for (size_t i = 0; i < vMatches.size(); i++)
+        {
+            _printMatch(i + 1, vMatches[i]);
+            cout << endl;
+        }
+        cout << setw(8) << left << "" << "---------------------------------------------------------------------------------------------------" << endl;
+
+        cout << "\n" << setw(8) << left << "" << vMatches.size() << " match(es) in " << microseconds << " us.\n";
+    }
+};
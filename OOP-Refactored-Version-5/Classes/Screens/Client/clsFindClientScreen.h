@@ -75,7 +75,6 @@ public:
     {
         findEntityScreen
         (
-            ClientsDataFile,
             "\t Find Client Info Screen",
             clsBankClient::readAccountNumber,
             clsBankClient::findClient,
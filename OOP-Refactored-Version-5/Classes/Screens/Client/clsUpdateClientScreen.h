@@ -13,7 +13,7 @@
  * - Prompt the user to enter an existing account number.
  * - Confirm whether the user wants to update the record.
  * - Allow modification of the client’s details.
- * - Save the updated client list to persistent storage.
+ * - Save the updated client record to persistent storage.
  *
  * ## Relationships
  * - **Inherits from:** `clsScreen` — for drawing headers and screen formatting.
@@ -49,7 +49,7 @@ using namespace std;
  * - Request the account number of the client to update.
  * - Confirm with the user before performing the update.
  * - Modify the client’s details via `clsBankClient::_changeClientRecord()`.
- * - Save the modified client list to persistent storage.
+ * - Save the modified client record to persistent storage.
  * - Display updated client details after successful update.
  *
  * @note Updates only succeed if the client object is in `UpdateMode`.
@@ -66,7 +66,7 @@ public:
      * - Asks the user to confirm before proceeding.
      * - If confirmed and the client is in `UpdateMode`:
      * - Updates the client’s details.
-     * - Saves the modified client list to persistent storage.
+     * - Saves the modified client record to persistent storage.
      * - Displays the updated client information.
      * - If the client object is not in `UpdateMode`, the update fails.
      *
@@ -80,10 +80,10 @@ public:
             "\tUpdate Client Info Screen",
             "\nClient Updated Successfully.\n",
             clsBankClient::readAccountNumber,
-            clsBankClient::findClientRef,
+            clsBankClient::findClient,
             clsPrintPersonCard::printClientInfo,
             clsBankClient::_changeClientRecord,
-            clsBankClient::saveClientDataIntoFile
+            clsBankClient::saveClientRecord
         );
 
 
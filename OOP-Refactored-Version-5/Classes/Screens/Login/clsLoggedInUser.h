@@ -7,7 +7,7 @@
  * functionality to:
  * - Parse login records from a log file
  * - Convert log entries into structured objects
- * - Retrieve all login records as a vector
+ * - Retrieve all login records as a vector (or as arena-aware `stLoginRecordView`s)
  * - Clear all login records
  *
  * ## Responsibilities
@@ -18,6 +18,7 @@
  * ## Relationships
  * - **Uses**:
  *   - `clsString` for string splitting.
+ *   - `clsLogScanner` for parsing the log file in parallel chunks.
  *   - `clsUtil` (not directly here but part of utilities).
  *   - Standard I/O and file stream operations (`<fstream>`).
  */
@@ -27,8 +28,21 @@
 #include <fstream>
 #include "../../Utils/clsString.h"
 #include "../../Utils/clsUtil.h"
+#include "../../Utils/clsMetrics.h"
+#include "../../Utils/clsLogScanner.h"
+#include "../../Utils/clsArena.h"
 using namespace std;
 
+/**
+ * @struct stLoginRecordView
+ * @brief An arena-aware login record: the text fields view the log bytes held by a `clsArena`.
+ */
+struct stLoginRecordView
+{
+    string_view loginTimeRecord, userName, password;
+    short accessValue = 0;
+};
+
 /**
  * @class clsLoggedInUser
  * @brief Represents a single login record and provides utilities to manage login history.
@@ -75,34 +89,21 @@ private:
      * @brief Loads all login records from a file into a vector of `clsLoggedInUser` objects.
      *
      * @param fileName The log file path/name.
+     * @param stats Optional; receives the record count and the scan speed.
      * @return A vector of `clsLoggedInUser` objects.
      *
      * ## Behavior
-     * - Reads line by line.
+     * - Parses the file in parallel, newline-aligned chunks (`clsLogScanner`), keeping the file order.
      * - Converts each line using `_convertLoginRecordIntoUserObject`.
-     * - Skips empty files safely.
+     * - Skips empty files (and empty lines) safely.
      */
-    static vector <clsLoggedInUser> _loadLoginRecordFileIntoVector(string fileName)
+    static vector <clsLoggedInUser> _loadLoginRecordFileIntoVector(string fileName, clsLogScanner::stScanStats * stats = nullptr)
     {
-        vector <clsLoggedInUser> vUsers;
-
-        fstream myFile;
-        myFile.open(fileName, ios::in);
+        static clsMetrics::clsHistogram & loadLatency = clsMetrics::histogram("loginRecord.load");
+        clsMetrics::clsScopedTimer timer(loadLatency);
 
-        if (myFile.is_open())
-        {
-            string line;
-
-            while(getline(myFile, line))
-            {
-                clsLoggedInUser user = _convertLoginRecordIntoUserObject(line);
-
-                vUsers.push_back(user);
-            }
-            myFile.close();
-        }
-
-        return vUsers;
+        return clsLogScanner::readAll<clsLoggedInUser>(fileName,
+            [](const string& line) { return _convertLoginRecordIntoUserObject(line); }, stats);
     }
 
 public:
@@ -163,11 +164,38 @@ public:
      * @brief Retrieves all login records from a file into a vector.
      *
      * @param fileName The log file path/name.
+     * @param stats Optional; receives the record count and the scan speed.
      * @return Vector of `clsLoggedInUser` objects.
      */
-    static vector <clsLoggedInUser> getLoginRecordVector(string fileName)
+    static vector <clsLoggedInUser> getLoginRecordVector(string fileName, clsLogScanner::stScanStats * stats = nullptr)
     {
-        return _loadLoginRecordFileIntoVector(fileName);
+        return _loadLoginRecordFileIntoVector(fileName, stats);
+    }
+
+    /**
+     * @brief Loads all login records into an arena, as views of the log bytes.
+     *
+     * The whole load is a few arena allocations (the file bytes and the record array),
+     * and everything is released at once with the arena.
+     *
+     * @param fileName The log file path/name.
+     * @param arena The arena holding the records; they must not outlive it.
+     * @param stats Optional; receives the record count and the scan speed.
+     */
+    static clsArenaVector <stLoginRecordView> getLoginRecordViews(string fileName, clsArena & arena, clsLogScanner::stScanStats * stats = nullptr)
+    {
+        static clsMetrics::clsHistogram & loadLatency = clsMetrics::histogram("loginRecord.load");
+        clsMetrics::clsScopedTimer timer(loadLatency);
+
+        return clsLogScanner::readAllViews<stLoginRecordView>(fileName, arena, [](string_view line)
+        {
+            string_view arFields[4];
+            stLoginRecordView record;
+
+            if (clsString::splitView(line, arFields, 4, "#//#") == 4)
+                record = {arFields[0], arFields[1], arFields[2], (short)clsString::parseDouble(arFields[3])};
+            return record;
+        }, stats);
     }
 
     /**
@@ -37,19 +37,21 @@ using namespace std;
 class clsLoginListRecordScreen : protected clsScreen
 {
 private:
-    static void _printLoginRecordData(clsLoggedInUser loginRecord)
+    static void _printLoginRecordData(const stLoginRecordView & loginRecord)
     {
-        cout << setw(20) << left << "" << "| " << setw(30) << left << loginRecord.getLoginTimeRecord();
-        // cout << "| " << setw(15) << left << loginRecord.getPassword();
+        cout << setw(20) << left << "" << "| " << setw(30) << left << loginRecord.loginTimeRecord;
+        // cout << "| " << setw(15) << left << loginRecord.password;
         cout << "| " << setw(15) << left << "****";
-        cout << "| " << setw(17) << left << loginRecord.getUserName();
-        cout << "| " << setw(14) << left << loginRecord.getAccessValue() << "|";
+        cout << "| " << setw(17) << left << loginRecord.userName;
+        cout << "| " << setw(14) << left << loginRecord.accessValue << "|";
     }
 
 public:
     static void showloginRecordsList()
     {
-        vector <clsLoggedInUser> vLoggedInUser = clsLoggedInUser::getLoginRecordVector(LoginRegisterFile);
+        clsLogScanner::stScanStats scanStats;
+        clsArena arena;
+        clsArenaVector <stLoginRecordView> vLoggedInUser = clsLoggedInUser::getLoginRecordViews(LoginRegisterFile, arena, &scanStats);
 
         string title = "\tLogin Records List Screen";
         string subTitle = "\t      Users List (" + to_string(vLoggedInUser.size()) + "):";
@@ -67,11 +69,13 @@ public:
             cout << "\t\t\tNo Data Available in the System" << endl;
         }
 
-        for (clsLoggedInUser & loggedUser : vLoggedInUser)
+        for (const stLoginRecordView & loggedUser : vLoggedInUser)
         {
             _printLoginRecordData(loggedUser);
             cout << endl;
         }
         cout << setw(20) << left << "" <<  "-------------------------------------------------------------------------------------" << endl;
+        cout << setw(20) << left << "" << "Scanned " << scanStats.records << " records in " << (long long)(scanStats.seconds * 1000000)
+             << " us (" << (long long)scanStats.getRecordsPerSecond() << " records/s)." << endl;
     }
 };
@@ -38,6 +38,8 @@
 #include <iostream>
 #include "../../Core/clsBankUser.h"
 #include "../../Utils/clsDate.h"
+#include "../../Utils/clsMetrics.h"
+#include "../../Utils/clsTracer.h"
 using namespace std;
 
 /**
@@ -111,6 +113,10 @@ private:
      */
     static void _saveLoginRecordIntoFile(const string & fileName, const clsBankUser & userRecord)
     {
+        static clsMetrics::clsHistogram & appendLatency = clsMetrics::histogram("loginRecord.logAppend");
+        clsMetrics::clsScopedTimer timer(appendLatency);
+        clsTraceSpan span("clsLoginLogger::_saveLoginRecordIntoFile");
+
         fstream myFile;
         string loginRecord = _returnLoginRecordData(userRecord);
 
@@ -130,6 +136,10 @@ private:
      */
     static void _saveLoginRecordIntoFile(const string & fileName)
     {
+        static clsMetrics::clsHistogram & appendLatency = clsMetrics::histogram("loginRecord.logAppend");
+        clsMetrics::clsScopedTimer timer(appendLatency);
+        clsTraceSpan span("clsLoginLogger::_saveLoginRecordIntoFile");
+
         fstream myFile;
         string loginRecord = _returnLoginRecordData();
 
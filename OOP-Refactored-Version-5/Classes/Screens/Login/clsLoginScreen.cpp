@@ -6,6 +6,8 @@
 #include "../../Core/clsBankUser.h"
 #include "../../Core/clsGlobal.h"
 #include "../../Utils/clsInputValidation.h"
+#include "../../Utils/clsMetrics.h"
+#include "../../Utils/clsTracer.h"
 using namespace std;
 
 void clsLoginScreen::_login()
@@ -22,8 +24,16 @@ void clsLoginScreen::_login()
         cout << "Enter Password? \n";
         password = clsInputValidation::readString();
 
-        currentUser = clsBankUser::findUserByUserNameAndPassword(userName, password);
+        {
+            static clsMetrics::clsHistogram & latency = clsMetrics::histogram("login.authenticate");
+            clsMetrics::clsScopedTimer timer(latency);
+            clsTraceSpan span("clsBankUser::findUserByUserNameAndPassword");
+            currentUser = clsBankUser::findUserByUserNameAndPassword(userName, password);
+        }
         loginFailed = currentUser.isEmpty();
+        static clsMetrics::clsCounter & failedLogins = clsMetrics::counter("login.failed");
+        static clsMetrics::clsCounter & succeededLogins = clsMetrics::counter("login.succeeded");
+        (loginFailed ? failedLogins : succeededLogins).increment();
 
         if(loginFailed)
         {
@@ -8,18 +8,34 @@
 #include "../Client/clsDeleteClientScreen.h"
 #include "../Client/clsUpdateClientScreen.h"
 #include "../Client/clsFindClientScreen.h"
+#include "../Client/clsFindClientByNameScreen.h"
 #include "../Login/clsLoginListRecordScreen.h"
+#include "clsMetricsScreen.h"
+#include "../../Utils/clsMetrics.h"
+#include "../../Utils/clsTracer.h"
 using namespace std; 
 
 void clsMainScreen::_performMainMenuChoice(enChoice choice)
 {
     switch (choice)
     {
+        case enChoice::ShowMetrics :
+        {
+            // hidden admin entry, not listed in the menu.
+            if (currentUser.getAccessValue() == -1)
+                clsMetricsScreen::showMetrics();
+            else clsBankUser::printAccessDeniedMessage();
+            break;
+        }
         case enChoice::ShowClientList :
         {
             // if (clsBankUser::isUserHasPermission(enChoice::ShowClientList))
             if (currentUser.isUserHasPermission(enPermissions::showing))
+            {
+                static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.showClientList");
+                clsMetrics::clsScopedTimer timer(latency);
                 clsClientListScreen::showClientsList();
+            }
             else clsBankUser::printAccessDeniedMessage();
             break;
         }
@@ -27,7 +43,11 @@ void clsMainScreen::_performMainMenuChoice(enChoice choice)
         {
             // if (clsBankUser::isUserHasPermission(enChoice::AddNewClient))
             if (currentUser.isUserHasPermission(enPermissions::adding))
+            {
+                static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.addNewClient");
+                clsMetrics::clsScopedTimer timer(latency);
                 clsAddNewClientScreen::addNewClientScreen();
+            }
             else clsBankUser::printAccessDeniedMessage();
             break;
         }
@@ -35,7 +55,11 @@ void clsMainScreen::_performMainMenuChoice(enChoice choice)
         {
             // if (clsBankUser::isUserHasPermission(enChoice::DeleteClient))
             if (currentUser.isUserHasPermission(enPermissions::deleting))
+            {
+                static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.deleteClient");
+                clsMetrics::clsScopedTimer timer(latency);
                 clsDeleteClientScreen::deleteClientScreen();
+            }
             else clsBankUser::printAccessDeniedMessage();
             break;
         }
@@ -43,7 +67,11 @@ void clsMainScreen::_performMainMenuChoice(enChoice choice)
         {
             // if (clsBankUser::isUserHasPermission(enChoice::UpdateClientInfo))
             if (currentUser.isUserHasPermission(enPermissions::updating))
+            {
+                static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.updateClient");
+                clsMetrics::clsScopedTimer timer(latency);
                 clsUpdateClientScreen::updateClientScreen();
+            }
             else clsBankUser::printAccessDeniedMessage();
             break;
         }
@@ -51,7 +79,22 @@ void clsMainScreen::_performMainMenuChoice(enChoice choice)
         {
             // if (clsBankUser::isUserHasPermission(enChoice::FindClient))
             if (currentUser.isUserHasPermission(enPermissions::finding))
+            {
+                static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.findClient");
+                clsMetrics::clsScopedTimer timer(latency);
                 clsFindClientScreen::findClientScreen();
+            }
+            else clsBankUser::printAccessDeniedMessage();
+            break;
+        }
+        case enChoice::FindClientByName :
+        {
+            if (currentUser.isUserHasPermission(enPermissions::finding))
+            {
+                static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.findClientByName");
+                clsMetrics::clsScopedTimer timer(latency);
+                clsFindClientByNameScreen::findClientByNameScreen();
+            }
             else clsBankUser::printAccessDeniedMessage();
             break;
         }
@@ -74,12 +117,19 @@ void clsMainScreen::_performMainMenuChoice(enChoice choice)
         case enChoice::ShowLoginRecordsList:
         {
             if (currentUser.isUserHasPermission(enPermissions::loginRecords))
-            clsLoginListRecordScreen::showloginRecordsList();
+            {
+                static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.showLoginRecords");
+                clsMetrics::clsScopedTimer timer(latency);
+                clsLoginListRecordScreen::showloginRecordsList();
+            }
             else clsBankUser::printAccessDeniedMessage();
             break;
         }
         case enChoice::LogOut :
         {
+            // a session may be followed by many more: save what it measured and traced now, not only when the program ends.
+            clsMetrics::dumpToFile(MetricsFile);
+            clsTracer::exportIfEnabled();
             currentUser = clsBankUser::findUserByUserNameAndPassword("", "");
             clsLoginScreen::showLogInScreen();
             break;
@@ -99,10 +149,11 @@ void clsMainScreen::showMainMenu()
     cout << setw(40) << left << "" << "\t[3] Delete Client.\n" ;
     cout << setw(40) << left << "" << "\t[4] Update Client Info.\n" ;
     cout << setw(40) << left << "" << "\t[5] Find Client.\n" ;
-    cout << setw(40) << left << "" << "\t[6] Transactions.\n" ;
-    cout << setw(40) << left << "" << "\t[7] Manage Users.\n" ;
-    cout << setw(40) << left << "" << "\t[8] Show Login Records List.\n" ;
-    cout << setw(40) << left << "" << "\t[9] Log Out.\n" ;
+    cout << setw(40) << left << "" << "\t[6] Find Client By Name.\n" ;
+    cout << setw(40) << left << "" << "\t[7] Transactions.\n" ;
+    cout << setw(40) << left << "" << "\t[8] Manage Users.\n" ;
+    cout << setw(40) << left << "" << "\t[9] Show Login Records List.\n" ;
+    cout << setw(40) << left << "" << "\t[10] Log Out.\n" ;
     cout << setw(40) << left << "" << "===========================================\n" ;
     _performMainMenuChoice((enChoice)_readMainMenuChoice());
 }
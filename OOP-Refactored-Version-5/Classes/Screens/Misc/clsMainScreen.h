@@ -39,7 +39,7 @@ using namespace std;
  * ## Overview
  * The `clsMainScreen` class serves as the central navigation point of the system
  * after login. It presents the main menu options and allows the user to:
- * - Manage clients (list, add, delete, update, find).
+ * - Manage clients (list, add, delete, update, find by account number or by name).
  * - Perform transactions (deposit, withdraw, transfer, etc.).
  * - Access user management (list, add, delete, update, find).
  * - View login history records.
@@ -68,17 +68,17 @@ private:
     /**
      * @brief Reads and validates the current(logged-in) user's main menu choice.
      *
-     * @return short The validated menu option (between 1 and 9).
+     * @return short The validated menu option (between 0 and 10).
      *
      * ## Behavior
      * - Prompts the user to enter a choice.
-     * - Validates that the choice is within range [1–9].
+     * - Validates that the choice is within range [0–10], where 0 is the hidden metrics entry.
      * - Returns the chosen option for further processing.
      */
     static short _readMainMenuChoice()
     {
-        cout << setw(31) << left << " " << "Choose What Do You Want to do? [1 to 9]? " ;
-        short choice = clsInputValidation::readShortNumberBetween(1, 9, "Enter a Number from 1 to 9");
+        cout << setw(31) << left << " " << "Choose What Do You Want to do? [1 to 10]? " ;
+        short choice = clsInputValidation::readShortNumberBetween(0, 10, "Enter a Number from 1 to 10");
         return choice;
     }
 
@@ -94,10 +94,12 @@ private:
      * - `enChoice::DeleteClient` → `clsDeleteClientScreen::deleteClientScreen()`
      * - `enChoice::UpdateClientInfo` → `clsUpdateClientScreen::updateClientScreen()`
      * - `enChoice::FindClient` → `clsFindClientScreen::findClientScreen()`
+     * - `enChoice::FindClientByName` → `clsFindClientByNameScreen::findClientByNameScreen()`
      * - `enChoice::Transactions` → `clsTransactionScreen::showTransactionsMenu()`
      * - `enChoice::ManageUsers` → `clsUserScreen::showUserMenu()`
      * - `enChoice::ShowLoginRecordsList` → `clsLoginListRecordScreen::showloginRecordsList()`
      * - `enChoice::LogOut` → Returns to login screen.
+     * - `enChoice::ShowMetrics` → `clsMetricsScreen::showMetrics()` (hidden, full-access users only).
      *
      * @note Implemented in the `.cpp` file.
      */
@@ -0,0 +1,42 @@
+/**
+ * @file clsMetricsScreen.h
+ * @brief Defines the `clsMetricsScreen` class for displaying the system metrics.
+ *
+ * ## Overview
+ * The `clsMetricsScreen` class renders every counter and latency histogram registered in
+ * `clsMetrics` (load, save, log-range and log-append latencies, menu actions, login outcomes ...)
+ * and saves the same report into the metrics file.
+ *
+ * ## Relationships
+ * - **Inherits from:** `clsScreen` — for drawing screen headers.
+ * - **Uses:** `clsMetrics` — the registry holding the counters and histograms.
+ *
+ * @note This screen is a hidden admin entry of the main menu (choice 0), reserved for full-access users.
+ */
+#pragma once
+#include <iostream>
+#include "clsScreen.h"
+#include "../../Core/clsGlobal.h"
+#include "../../Utils/clsMetrics.h"
+using namespace std;
+
+/**
+ * @class clsMetricsScreen
+ * @brief Screen class that prints the metrics registry on demand.
+ */
+class clsMetricsScreen : protected clsScreen
+{
+public:
+    /**
+     * @brief Displays all registered metrics and dumps them into `MetricsFile`.
+     */
+    static void showMetrics()
+    {
+        _drawScreenHeader("\t\tMetrics Screen");
+
+        clsMetrics::print(cout);
+        clsMetrics::dumpToFile(MetricsFile);
+
+        cout << "\nMetrics saved into [" << MetricsFile << "]." << endl;
+    }
+};
@@ -31,14 +31,16 @@ using namespace std;
  * It is designed to ensure a consistent UI layout across different screens.
  *
  * ## Methods
- * - `static void printClientInfo(clsBankClient)` — Prints full client information.
- * - `static void printTransferClientInfo(clsBankClient)` — Prints limited client information
+ * - `static void printClientInfo(const clsBankClient &)` — Prints full client information.
+ * - `static void printTransferClientInfo(const clsBankClient &)` — Prints limited client information
  *   (for transfers).
- * - `static void printUserInfo(clsBankUser)` — Prints full user information.
+ * - `static void printUserInfo(const clsBankUser &)` — Prints full user information.
  *
  * ## Design
  * - **Static Class**: All methods are `static` to allow direct use without instantiating the class.
  * - **Output Format**: Information is printed in a bordered "card" style for readability.
+ * - **No Copies**: Cards take the entity by const reference and stream its fields directly
+ *   (the full name is written as its two parts), so printing a card allocates nothing.
  */
 class clsPrintPersonCard
 {
@@ -59,13 +61,13 @@ public:
      * - PIN code
      * - Account balance
      */
-    static void printClientInfo(clsBankClient client)
+    static void printClientInfo(const clsBankClient & client)
     {
         cout << "\nClient Card:" << endl;
         cout << "- - - - - - - - - - - - - - - - - - -\n";
         cout << "First Name: " << client.getFirstName() << endl;
         cout << "Last Name: " << client.getLastName() << endl;
-        cout << "Full Name: " << client.FullName() << endl;
+        cout << "Full Name: " << client.getFirstName() << ' ' << client.getLastName() << endl;
         cout << "Email: " << client.getEmail() << endl;
         cout << "Phone: " << client.getPhone() << endl;
         cout << "Account Number: " << client.getAccountNumber() << endl;
@@ -84,11 +86,11 @@ public:
      * - Account number
      * - Account balance
      */
-    static void printTransferClientInfo(clsBankClient client)
+    static void printTransferClientInfo(const clsBankClient & client)
     {
         cout << "\nClient Card:" << endl;
         cout << "- - - - - - - - - - - - - - - - - - -\n";
-        cout << "Full Name: " << client.FullName() << endl;
+        cout << "Full Name: " << client.getFirstName() << ' ' << client.getLastName() << endl;
         cout << "Account Number: " << client.getAccountNumber() << endl;
         cout << "Account Balance: " << client.getAccountBalance() << endl;
         cout << "- - - - - - - - - - - - - - - - - - -\n\n";
@@ -109,13 +111,13 @@ public:
      * - Password
      * - Access value (permissions bitmask/role level)
      */
-    static void printUserInfo(clsBankUser user)
+    static void printUserInfo(const clsBankUser & user)
     {
         cout << "\nUser Card:" << endl;
         cout << "- - - - - - - - - - - - - - - - - - -\n";
         cout << "First Name: " << user.getFirstName() << endl;
         cout << "Last Name: " << user.getLastName() << endl;
-        cout << "Full Name: " << user.FullName() << endl;
+        cout << "Full Name: " << user.getFirstName() << ' ' << user.getLastName() << endl;
         cout << "Email: " << user.getEmail() << endl;
         cout << "Phone: " << user.getPhone() << endl;
         cout << "UserName: " << user.getUserName() << endl;
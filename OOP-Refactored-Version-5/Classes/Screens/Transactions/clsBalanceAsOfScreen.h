@@ -0,0 +1,99 @@
+/**
+ * @file clsBalanceAsOfScreen.h
+ * @brief Defines the `clsBalanceAsOfScreen` class, which shows the balance of an account on a past date.
+ *
+ * ## Overview
+ * Reads an account number and a date, then asks `clsBalanceCheckpoints` for the balance the
+ * transfer log left the account at the end of that day. Prints the balance, the log offset of the
+ * transfer that left it, the checkpoint the lookup started from, the number of transfers replayed
+ * and the time taken.
+ *
+ * Deposits, withdrawals and interest postings are not in the transfer log, so the screen says the
+ * balance comes from transfers only, and prints the outcome of the check `balanceAsOf()` makes:
+ * confirmed, possibly stale (with the balance the next transfer or the clients file shows
+ * instead), or not checked.
+ *
+ * ## Relationships
+ * - **Inherits from:** `clsScreen` — for drawing the screen header.
+ * - **Uses:** `clsBalanceCheckpoints`, `clsBankClient` (account number input).
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include "../Misc/clsScreen.h"
+#include "../../Core/clsBankClient.h"
+#include "../../Core/clsBalanceCheckpoints.h"
+#include "../../Utils/clsInputValidation.h"
+#include "../../Utils/clsDate.h"
+using namespace std;
+
+/**
+ * @class clsBalanceAsOfScreen
+ * @brief Screen looking up the balance of one account at the end of a past day.
+ */
+class clsBalanceAsOfScreen : protected clsScreen
+{
+private:
+    static clsDate _readDate()
+    {
+        clsDate today;
+
+        cout << "\nEnter the year [2000 to " << today.getYear() << "]? ";
+        int year = clsInputValidation::readIntNumberBetween(2000, today.getYear(), "Enter a Number from 2000 to " + to_string(today.getYear()) + ": ");
+
+        cout << "Enter the month [1 to 12]? ";
+        int month = clsInputValidation::readIntNumberBetween(1, 12, "Enter a Number from 1 to 12: ");
+
+        int monthDays = clsDate::getMonthDays(year, month);
+        cout << "Enter the day [1 to " << monthDays << "]? ";
+        int day = clsInputValidation::readIntNumberBetween(1, monthDays, "Enter a Number from 1 to " + to_string(monthDays) + ": ");
+
+        return clsDate(day, month, year);
+    }
+
+public:
+    /**
+     * @brief Reads an account and a date, then prints the balance of the account at the end of that day.
+     */
+    static void balanceAsOfScreen()
+    {
+        _drawScreenHeader("\t  Balance As Of Date Screen");
+
+        cout << "\n";
+        string accountNumber = clsBankClient::readAccountNumber(enStatus::Exist);
+
+        clsDate date = _readDate();
+        stBalanceAsOf result = clsBalanceCheckpoints::balanceAsOf(accountNumber, clsDate::endOfDayKey(date));
+
+        if (!result.found)
+        {
+            cout << "\nAccount [" << accountNumber << "] had no transfers up to " << clsDate::DateToString(date) << "." << endl;
+            return;
+        }
+
+        cout << "\n" << setw(8) << left << "" << "Account            : " << accountNumber << endl;
+        cout << setw(8) << left << "" << "End of Day         : " << clsDate::DateToString(date) << endl;
+        cout << setw(8) << left << "" << "Balance            : " << fixed << setprecision(2) << result.balance << defaultfloat << endl;
+        cout << setw(8) << left << "" << "Last Transfer At   : offset " << result.lastOffset << endl;
+        cout << setw(8) << left << "" << "From Checkpoint    : " << result.checkpoint << endl;
+        cout << setw(8) << left << "" << "Transfers Replayed : " << result.replayedRecords << endl;
+        cout << setw(8) << left << "" << "Time Taken         : " << result.milliseconds << " ms" << endl;
+
+        cout << "\nFrom transfers only: deposits, withdrawals and interest postings are not in the transfer log." << endl;
+
+        switch (result.check)
+        {
+        case enBalanceAsOfCheck::Confirmed:
+            cout << "Checked: " << (result.nextInStore ? "the clients file still holds" : "the next transfer starts from") << " this balance." << endl;
+            break;
+        case enBalanceAsOfCheck::Changed:
+            cout << "Possibly stale: " << (result.nextInStore ? "the clients file now holds " : "the next transfer (offset " + to_string(result.nextOffset) + ") starts from ")
+                 << fixed << setprecision(2) << result.nextBalance << defaultfloat
+                 << ", so a deposit, withdrawal or interest posting moved the balance after its last transfer up to that day." << endl;
+            break;
+        case enBalanceAsOfCheck::Unchecked:
+            cout << "Not checked: the account is no longer in the clients file." << endl;
+            break;
+        }
+    }
+};
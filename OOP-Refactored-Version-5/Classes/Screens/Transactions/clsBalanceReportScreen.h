@@ -0,0 +1,162 @@
+/**
+ * @file clsBalanceReportScreen.h
+ * @brief Defines the `clsBalanceReportScreen` class, which reports how the client balances are distributed.
+ *
+ * ## Overview
+ * Risk reporting used to mean exporting `Clients.txt` into other tools. This screen reads a bucket
+ * width and a bucket count, and a quantile mode (exact or approximate), then prints:
+ * - the number of clients, the total, minimum, maximum and mean balance;
+ * - a histogram of the balances, with the number of clients, their share and their total balance per bucket;
+ * - the p0 / p25 / p50 / p75 / p90 / p95 / p99 / p100 balances.
+ *
+ * The report can then be exported as CSV to `BalanceReportFile`.
+ *
+ * ## Relationships
+ * - **Inherits from:** `clsScreen` — for drawing the screen header.
+ * - **Uses:** `clsBankClient::getBalanceColumn()` for the balances, and `clsDistributionReport`
+ *   to compute the report in parallel and to write the CSV.
+ *
+ * ## Notable Implementation Details
+ * - Exact quantiles use a parallel selection over a copy of the balances; the approximate mode
+ *   merges one `clsQuantileSketch` per worker instead (about 1% rank error, and much less memory traffic).
+ * - The time taken by the report is printed under the tables.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include "../Misc/clsScreen.h"
+#include "../../Core/clsBankClient.h"
+#include "../../Core/clsGlobal.h"
+#include "../../Utils/clsInputValidation.h"
+#include "../../Utils/clsDistributionReport.h"
+#include "../../Utils/clsUtil.h"
+using namespace std;
+
+/**
+ * @class clsBalanceReportScreen
+ * @brief Screen printing the balance histogram and quantiles, and exporting them as CSV.
+ */
+class clsBalanceReportScreen : protected clsScreen
+{
+private:
+    static const int _barWidth = 30;
+
+    static vector <double> _reportedQuantiles()
+    {
+        return {0, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99, 1};
+    }
+
+    static stHistogramSpec _readHistogramSpec()
+    {
+        stHistogramSpec spec;
+
+        cout << "\nEnter the width of a balance bucket [1 to 1000000000]? ";
+        spec.binWidth = clsInputValidation::readIntNumberBetween(1, 1000000000, "Enter a Number from 1 to 1000000000: ");
+
+        cout << "Enter the number of buckets [1 to 50]? ";
+        spec.binCount = clsInputValidation::readIntNumberBetween(1, 50, "Enter a Number from 1 to 50: ");
+
+        return spec;
+    }
+
+    static void _printSummary(const stDistributionReport & report)
+    {
+        cout << "\n" << setw(8) << left << "" << "Clients : " << report.count << endl;
+        cout << setw(8) << left << "" << "Total   : " << fixed << setprecision(2) << (double)report.sum << endl;
+        cout << setw(8) << left << "" << "Minimum : " << report.minValue << endl;
+        cout << setw(8) << left << "" << "Maximum : " << report.maxValue << endl;
+        cout << setw(8) << left << "" << "Mean    : " << report.mean() << endl;
+        cout << defaultfloat;
+    }
+
+    static void _printHistogram(const stDistributionReport & report)
+    {
+        size_t largestBin = 1;
+        for (const stHistogramBin & bin : report.vBins)
+            largestBin = max(largestBin, bin.count);
+
+        cout << "\n" << setw(8) << left << "" << "------------------------------------------------------------------------------------------------------" << endl;
+        cout << setw(8) << left << "" << "| " << left << setw(25) << "Balance:";
+        cout << "| " << left << setw(10) << "Clients:";
+        cout << "| " << left << setw(8) << "Share:";
+        cout << "| " << left << setw(18) << "Total Balance:";
+        cout << "| " << left << setw(_barWidth) << "" << "|" << endl;
+        cout << setw(8) << left << "" << "------------------------------------------------------------------------------------------------------" << endl;
+
+        for (const stHistogramBin & bin : report.vBins)
+        {
+            double share = report.count == 0 ? 0 : 100.0 * bin.count / report.count;
+
+            cout << setw(8) << left << "" << "| " << left << setw(25) << bin.label;
+            cout << "| " << left << setw(10) << bin.count;
+            cout << "| " << left << setw(8) << (to_string((int)round(share)) + "%");
+            cout << "| " << left << setw(18) << fixed << setprecision(2) << (double)bin.sum << defaultfloat;
+            cout << "| " << left << setw(_barWidth) << string(bin.count * _barWidth / largestBin, '#') << "|" << endl;
+        }
+        cout << setw(8) << left << "" << "------------------------------------------------------------------------------------------------------" << endl;
+    }
+
+    static void _printQuantiles(const stDistributionReport & report)
+    {
+        cout << "\n" << setw(8) << left << "" << "Quantiles (" << (report.exactQuantiles ? "exact" : "approximate") << "):" << endl;
+        cout << setw(8) << left << "" << "-----------------------------" << endl;
+
+        for (const stQuantile & quantile : report.vQuantiles)
+        {
+            cout << setw(8) << left << "" << "| " << left << setw(6) << clsDistributionReport::quantileLabel(quantile.q);
+            cout << "| " << left << setw(18) << fixed << setprecision(2) << quantile.value << defaultfloat << "|" << endl;
+        }
+        cout << setw(8) << left << "" << "-----------------------------" << endl;
+    }
+
+    static void _exportCsv(const stDistributionReport & report)
+    {
+        fstream myFile;
+        myFile.open(BalanceReportFile, ios::out);
+
+        if (!myFile.is_open())
+        {
+            cout << "\nCould not write [" << BalanceReportFile << "]." << endl;
+            return;
+        }
+
+        clsDistributionReport::writeCsv(myFile, report);
+        myFile.close();
+
+        cout << "\nReport exported to [" << BalanceReportFile << "]." << endl;
+    }
+
+public:
+    /**
+     * @brief Reads the report options, prints the balance report and offers to export it as CSV.
+     */
+    static void showBalanceReport()
+    {
+        _drawScreenHeader("\t   Balance Report Screen");
+
+        stHistogramSpec spec = _readHistogramSpec();
+
+        cout << "Quantiles: [1] Exact  [2] Approximate? ";
+        bool exact = clsInputValidation::readShortNumberBetween(1, 2, "Enter a Number from 1 to 2: ") == 1;
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+        vector <double> vBalances = clsBankClient::getBalanceColumn(ClientsDataFile);
+        stDistributionReport report = clsDistributionReport::build(vBalances, spec, _reportedQuantiles(), exact);
+
+        long long milliseconds = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+        _printSummary(report);
+        _printHistogram(report);
+        _printQuantiles(report);
+
+        cout << "\n" << setw(8) << left << "" << "Report computed in " << milliseconds << " ms." << endl;
+
+        char ans = clsUtil::confirm("\nExport the report as CSV (Y/N)? ");
+
+        if (tolower(ans) == 'y')
+            _exportCsv(report);
+    }
+};
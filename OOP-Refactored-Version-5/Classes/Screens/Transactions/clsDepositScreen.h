@@ -12,9 +12,8 @@
  *
  * - **Uses**:
  *   -`clsBankClient`:**
- *   → Loads all clients from the data file.
- *   → Finds a client by account number.
- *   → Holds the client reference for updating balance.
+ *   → Finds a client by account number in the repository cache.
+ *   → Holds a copy of that one client record for updating its balance.
  * 
  *   -`clsPrintPersonCard`:
  *   → Displays client information before performing the transaction.
@@ -27,12 +26,11 @@
  *
  * ## Workflow
  * 1. Displays the deposit screen header.
- * 2. Loads all clients from the database file.
- * 3. Reads and validates the target account number.
- * 4. Locates the client object by reference.
- * 5. Displays client information.
- * 6. Reads and validates the deposit amount.
- * 7. Processes the transaction and updates the client’s balance.
+ * 2. Reads and validates the target account number.
+ * 3. Copies the matching client record from the repository cache.
+ * 4. Displays client information.
+ * 5. Reads and validates the deposit amount.
+ * 6. Processes the transaction and saves the client’s new balance.
  */
 
 #pragma once
@@ -60,30 +58,27 @@ public:
      *
      * ### Steps:
      * 1. Displays the deposit screen header.
-     * 2. Loads all clients from the `ClientsDataFile`.
-     * 3. Reads and validates the account number to ensure it exists.
-     * 4. Retrieves the matching client object by reference.
-     * 5. Prints the client’s information on the screen.
-     * 6. Prompts the user to enter a deposit amount, validating input.
-     * 7. Calls `clsTransactionHelper::makeTransaction` to apply the deposit and save changes.
+     * 2. Reads and validates the account number to ensure it exists.
+     * 3. Copies the matching client record with `clsBankClient::findClient`.
+     * 4. Prints the client’s information on the screen.
+     * 5. Prompts the user to enter a deposit amount, validating input.
+     * 6. Calls `clsTransactionHelper::makeTransaction` to apply the deposit and save changes.
      *
-     * @note The account balance is updated directly within the `vClients` vector,
-     *       ensuring persistence when saved by `makeTransaction`.
+     * @note The balance is updated on the copied record only; `makeTransaction` persists
+     *       that single record with `clsBankClient::saveClientRecord`.
      */
     static void depositScreen()
     {
         _drawScreenHeader("\t\t Deposit Screen");
 
-        vector<clsBankClient> vClients = clsBankClient::getListVectorFromFile(ClientsDataFile);
-
         string accountNumber = clsBankClient::readAccountNumber(enStatus::Exist);
 
-        clsBankClient &client = clsBankClient::findClientRef(accountNumber, vClients);
+        clsBankClient client = clsBankClient::findClient(accountNumber);
         clsPrintPersonCard::printClientInfo(client);
 
         cout << "\n\nPlease enter Deposit Amount? ";
         double depositAmount = clsInputValidation::readDblNumber("Invalid Input, Please Enter A Valid Number.");
 
-        clsTransactionHelper::makeTransaction(depositAmount, vClients, client);
+        clsTransactionHelper::makeTransaction(depositAmount, client);
     }
 };
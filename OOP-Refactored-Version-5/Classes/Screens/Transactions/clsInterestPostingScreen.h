@@ -0,0 +1,101 @@
+/**
+ * @file clsInterestPostingScreen.h
+ * @brief Defines the `clsInterestPostingScreen` class, which runs the end-of-day interest posting.
+ *
+ * ## Overview
+ * Shows the rate table read from `InterestRatesFile`, reads the number of days to accrue (1 for
+ * a daily run), and after confirmation credits every client through `clsInterestPosting`, then
+ * prints how many accounts were credited, the total interest and the time taken. When today's
+ * interest was posted already, it asks for an explicit confirmation before posting it again.
+ *
+ * ## Relationships
+ * - **Inherits from:** `clsScreen` — for drawing the screen header.
+ * - **Uses:** `clsInterestRateTable` and `clsInterestPosting`.
+ *
+ * @note The transactions menu opens this screen for full-access users only (access value -1).
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include "../Misc/clsScreen.h"
+#include "../../Core/clsGlobal.h"
+#include "../../Core/clsInterestRateTable.h"
+#include "../../Core/clsInterestPosting.h"
+#include "../../Utils/clsInputValidation.h"
+#include "../../Utils/clsUtil.h"
+using namespace std;
+
+/**
+ * @class clsInterestPostingScreen
+ * @brief Screen posting the interest of a number of days to every client account.
+ */
+class clsInterestPostingScreen : protected clsScreen
+{
+private:
+    static void _printRateTable(const clsInterestRateTable & rates)
+    {
+        cout << "\n" << setw(8) << left << "" << "Interest Rates (Actual/" << rates.getDayCountBasis() << "):" << endl;
+        cout << setw(8) << left << "" << "--------------------------------------" << endl;
+        cout << setw(8) << left << "" << "| " << left << setw(18) << "From Balance:";
+        cout << "| " << left << setw(15) << "Annual Rate:" << "|" << endl;
+        cout << setw(8) << left << "" << "--------------------------------------" << endl;
+
+        for (const stRateTier & tier : rates.getTiers())
+        {
+            cout << setw(8) << left << "" << "| " << left << setw(18) << fixed << setprecision(0) << tier.minimumBalance << defaultfloat;
+            cout << "| " << left << setw(15) << (to_string(tier.annualRatePercent).substr(0, 4) + "%") << "|" << endl;
+        }
+        cout << setw(8) << left << "" << "--------------------------------------" << endl;
+    }
+
+public:
+    /**
+     * @brief Reads the number of days, then posts the interest to every account after confirmation.
+     */
+    static void postInterestScreen()
+    {
+        _drawScreenHeader("\t  Post Interest Screen");
+
+        clsInterestRateTable rates = clsInterestRateTable::loadFromFile(InterestRatesFile);
+        _printRateTable(rates);
+
+        // posting twice for one business date credits every account twice: only on explicit request.
+        bool postAgain = false;
+        if (clsInterestPosting::lastPostedDate() == clsInterestPosting::businessDate())
+        {
+            cout << "\nThe interest of " << clsInterestPosting::businessDate() << " was already posted." << endl;
+            char ans = clsUtil::confirm("Post it AGAIN, crediting every account a second time (Y/N)? ");
+            if (tolower(ans) != 'y') return;
+            postAgain = true;
+        }
+
+        cout << "\nEnter the number of days to accrue [1 to 366]? ";
+        int days = clsInputValidation::readIntNumberBetween(1, 366, "Enter a Number from 1 to 366: ");
+
+        char ans = clsUtil::confirm("\nPost the interest of " + to_string(days) + " day(s) to every account (Y/N)? ");
+        if (tolower(ans) != 'y') return;
+
+        stInterestRunSummary summary = clsInterestPosting::postInterest(rates, days, postAgain);
+
+        if (summary.alreadyPosted)
+        {
+            cout << "\nInterest Posting Refused: the interest of " << summary.businessDate << " was posted meanwhile." << endl;
+            return;
+        }
+
+        if (!summary.committed)
+        {
+            cout << "\nInterest Posting Failed: " << summary.error << ", no account was changed." << endl;
+            return;
+        }
+
+        cout << "\nInterest Posted Successfully for " << summary.businessDate << "." << endl;
+        if (!summary.logged)
+            cout << "\nWarning: " << summary.error << "." << endl;
+        cout << setw(8) << left << "" << "Accounts Scanned  : " << summary.accountsScanned << endl;
+        cout << setw(8) << left << "" << "Accounts Credited : " << summary.accountsCredited << endl;
+        cout << setw(8) << left << "" << "Total Interest    : " << fixed << setprecision(2) << summary.totalInterestCents / 100.0 << defaultfloat << endl;
+        cout << setw(8) << left << "" << "Time Taken        : " << summary.milliseconds << " ms" << endl;
+        cout << setw(8) << left << "" << "Log               : " << InterestLogsFile << endl;
+    }
+};
@@ -0,0 +1,118 @@
+/**
+ * @file clsReconciliationScreen.h
+ * @brief Defines the `clsReconciliationScreen` class, which cross-checks the transfer log against the clients file.
+ *
+ * ## Overview
+ * Runs `clsLedgerReconciliation::reconcile()`, then prints how many transfers and accounts were
+ * checked, the number of discrepancies of every kind and the first ones by log offset. Every
+ * discrepancy is exported as CSV to `ReconciliationReportFile` (only the header when there is none).
+ *
+ * ## Relationships
+ * - **Inherits from:** `clsScreen` — for drawing the screen header.
+ * - **Uses:** `clsLedgerReconciliation`.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include "../Misc/clsScreen.h"
+#include "../../Core/clsGlobal.h"
+#include "../../Core/clsLedgerReconciliation.h"
+using namespace std;
+
+/**
+ * @class clsReconciliationScreen
+ * @brief Screen reconciling the transfer log with the client balances.
+ */
+class clsReconciliationScreen : protected clsScreen
+{
+private:
+    static const size_t _shownDiscrepancies = 20;
+
+    static void _printCounts(const stReconciliationSummary & summary)
+    {
+        cout << "\n" << setw(8) << left << "" << "Transfers Checked  : " << summary.recordsScanned << endl;
+        cout << setw(8) << left << "" << "Accounts Checked   : " << summary.accountsChecked << endl;
+
+        for (enDiscrepancyKind kind : {enDiscrepancyKind::MalformedRecord, enDiscrepancyKind::BalanceGap,
+                                       enDiscrepancyKind::StoreMismatch, enDiscrepancyKind::UnknownAccount})
+        {
+            cout << setw(8) << left << "" << left << setw(19) << clsLedgerReconciliation::kindLabel(kind) << ": " << summary.countOf(kind) << endl;
+        }
+
+        cout << setw(8) << left << "" << "Time Taken         : " << summary.milliseconds << " ms" << endl;
+    }
+
+    static void _printDiscrepancies(const stReconciliationSummary & summary)
+    {
+        size_t shown = min(_shownDiscrepancies, summary.vDiscrepancies.size());
+
+        cout << "\n" << setw(8) << left << "" << "First " << shown << " of " << summary.vDiscrepancies.size() << " discrepancies:" << endl;
+        cout << setw(8) << left << "" << "-----------------------------------------------------------------------------------------------------" << endl;
+        cout << setw(8) << left << "" << "| " << left << setw(18) << "Kind:";
+        cout << "| " << left << setw(12) << "Account:";
+        cout << "| " << left << setw(14) << "Log Offset:";
+        cout << "| " << left << setw(15) << "Expected:";
+        cout << "| " << left << setw(15) << "Recorded:";
+        cout << "| " << left << setw(14) << "Difference:" << "|" << endl;
+        cout << setw(8) << left << "" << "-----------------------------------------------------------------------------------------------------" << endl;
+
+        cout << fixed << setprecision(2);
+        for (size_t i = 0; i < shown; i++)
+        {
+            const stLedgerDiscrepancy & discrepancy = summary.vDiscrepancies[i];
+
+            cout << setw(8) << left << "" << "| " << left << setw(18) << clsLedgerReconciliation::kindLabel(discrepancy.kind);
+            cout << "| " << left << setw(12) << discrepancy.accountNumber;
+            cout << "| " << left << setw(14) << discrepancy.offset;
+            cout << "| " << left << setw(15) << discrepancy.expected;
+            cout << "| " << left << setw(15) << discrepancy.recorded;
+            cout << "| " << left << setw(14) << discrepancy.recorded - discrepancy.expected << "|" << endl;
+        }
+        cout << defaultfloat;
+        cout << setw(8) << left << "" << "-----------------------------------------------------------------------------------------------------" << endl;
+    }
+
+    static void _exportCsv(const stReconciliationSummary & summary)
+    {
+        fstream myFile;
+        myFile.open(ReconciliationReportFile, ios::out);
+
+        if (!myFile.is_open())
+        {
+            cout << "\nCould not write [" << ReconciliationReportFile << "]." << endl;
+            return;
+        }
+
+        clsLedgerReconciliation::writeCsv(myFile, summary);
+        myFile.close();
+
+        cout << "\nDiscrepancies exported to [" << ReconciliationReportFile << "]." << endl;
+    }
+
+public:
+    /**
+     * @brief Reconciles the transfer log with the clients file and prints the discrepancies.
+     */
+    static void reconciliationScreen()
+    {
+        _drawScreenHeader("\t  Ledger Reconciliation Screen");
+
+        stReconciliationSummary summary = clsLedgerReconciliation::reconcile();
+
+        if (!summary.completed)
+        {
+            cout << "\nReconciliation Failed: " << summary.error << "." << endl;
+            return;
+        }
+
+        _printCounts(summary);
+
+        if (summary.vDiscrepancies.empty())
+            cout << "\nThe transfer log and the clients file agree." << endl;
+        else
+            _printDiscrepancies(summary);
+
+        _exportCsv(summary);
+    }
+};
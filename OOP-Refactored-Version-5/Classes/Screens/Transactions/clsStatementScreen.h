@@ -0,0 +1,63 @@
+/**
+ * @file clsStatementScreen.h
+ * @brief Defines the `clsStatementScreen` class, which writes the monthly account statements.
+ *
+ * ## Overview
+ * Reads a month and a year, then writes the statement of every account with transfers in that
+ * month through `clsStatementGenerator`, and prints how many transfers were read, how many
+ * statements were written, how much was spilled to disk and the time taken.
+ *
+ * ## Relationships
+ * - **Inherits from:** `clsScreen` — for drawing the screen header.
+ * - **Uses:** `clsStatementGenerator`.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include "../Misc/clsScreen.h"
+#include "../../Core/clsGlobal.h"
+#include "../../Core/clsStatementGenerator.h"
+#include "../../Utils/clsInputValidation.h"
+#include "../../Utils/clsDate.h"
+using namespace std;
+
+/**
+ * @class clsStatementScreen
+ * @brief Screen writing the statements of one month into `StatementsFolder`.
+ */
+class clsStatementScreen : protected clsScreen
+{
+public:
+    /**
+     * @brief Reads the month and year, then writes the statements of that month.
+     */
+    static void statementScreen()
+    {
+        _drawScreenHeader("\t  Monthly Statements Screen");
+
+        clsDate today;
+
+        cout << "\nEnter the month [1 to 12]? ";
+        int month = clsInputValidation::readIntNumberBetween(1, 12, "Enter a Number from 1 to 12: ");
+
+        cout << "Enter the year [2000 to " << today.getYear() << "]? ";
+        int year = clsInputValidation::readIntNumberBetween(2000, today.getYear(), "Enter a Number from 2000 to " + to_string(today.getYear()) + ": ");
+
+        stStatementRunSummary summary = clsStatementGenerator::generateStatements(month, year);
+
+        if (!summary.completed)
+        {
+            cout << "\nStatements Failed: " << summary.error << "." << endl;
+            return;
+        }
+
+        cout << "\nStatements Written Successfully." << endl;
+        cout << setw(8) << left << "" << "Transfers Read     : " << summary.recordsScanned << endl;
+        cout << setw(8) << left << "" << "Transfers in Month : " << summary.recordsInPeriod << endl;
+        cout << setw(8) << left << "" << "Statements Written : " << summary.statementsWritten << endl;
+        cout << setw(8) << left << "" << "Partitions         : " << summary.partitionCount << endl;
+        cout << setw(8) << left << "" << "Spilled to Disk    : " << summary.spilledBytes / 1024 << " KB (" << summary.spillCount << " spills)" << endl;
+        cout << setw(8) << left << "" << "Time Taken         : " << summary.milliseconds << " ms" << endl;
+        cout << setw(8) << left << "" << "Folder             : " << summary.folder << endl;
+    }
+};
@@ -27,6 +27,7 @@
 #include <iostream>
 #include "../../Utils/clsUtil.h"
 #include "../../Core/clsBankClient.h"
+#include "../../Utils/clsTracer.h"
 
 /**
  * @class clsTransactionHelper
@@ -44,20 +45,21 @@ public:
      *
      * Prompts the user for confirmation before applying the transaction.
      * If confirmed, updates the client’s account balance and persists
-     * the updated list of clients to the storage file.
+     * only that client record to the storage file.
      *
      * @param amount The transaction amount (positive for deposit, negative for withdrawal).
-     * @param vClients Reference to the list of all bank clients.
      * @param client Reference to the client whose account is affected.
      */
-    static void makeTransaction(double amount, vector <clsBankClient> & vClients, clsBankClient & client)
+    static void makeTransaction(double amount, clsBankClient & client)
     {
         char ans = clsUtil::confirm("Are you sure you want to perform this transaction? (Y/N) ");
 
         if (tolower(ans) == 'y')
         {
+            clsTraceSpan span("clsTransactionHelper::makeTransaction");
+
             client.updateAccBalance(amount);
-            clsBankClient::saveClientDataIntoFile(ClientsDataFile, vClients);
+            clsBankClient::saveClientRecord(ClientsDataFile, client);
             cout << "Done Successfully, New Account Total Balance: " << client.getAccountBalance() << endl;
         }
     }
@@ -67,23 +69,27 @@ public:
      *
      * Prompts the user for confirmation before applying the transfer.
      * If confirmed, deducts the transfer amount from the source client’s balance,
-     * adds it to the destination client’s balance, and persists updated records.
+     * adds it to the destination client’s balance, and persists both records as one batch.
      *
      * @param amount The amount to transfer.
-     * @param vClients Reference to the list of all bank clients.
      * @param sourceClient Reference to the client sending money.
      * @param destinationClient Reference to the client receiving money.
+     * @return true when the transfer was confirmed and saved.
      */
-    static void transferAmountBetweenTwoAccounts(double amount, vector <clsBankClient> & vClients, clsBankClient & sourceClient, clsBankClient & destinationClient)
+    static bool transferAmountBetweenTwoAccounts(double amount, clsBankClient & sourceClient, clsBankClient & destinationClient)
     {
         char ans = clsUtil::confirm("Are you sure you want to perform this transaction? (Y/N) ");
 
         if (tolower(ans) == 'y')
         {
+            clsTraceSpan span("clsTransactionHelper::transferAmountBetweenTwoAccounts");
+
             sourceClient.updateAccBalance(-amount);
             destinationClient.updateAccBalance(+amount);
-            clsBankClient::saveClientDataIntoFile(ClientsDataFile, vClients);
+            clsBankClient::saveClientRecords(ClientsDataFile, {sourceClient, destinationClient});
             cout << "\nTransfer Done Successfully." << endl;
+            return true;
         }
+        return false;
     }
 };
@@ -7,38 +7,101 @@
 #include "clsWithdrawScreen.h"
 #include "clsTransferScreen.h"
 #include "clsTransferListRecordScreen.h"
+#include "clsBalanceReportScreen.h"
+#include "clsInterestPostingScreen.h"
+#include "clsStatementScreen.h"
+#include "clsReconciliationScreen.h"
+#include "clsBalanceAsOfScreen.h"
+#include "clsTransferAnalyticsScreen.h"
+#include "../../Utils/clsMetrics.h"
 using namespace std; 
 
 void clsTransactionScreen::_performTransactionsChoice(enTransactionChoice transactionChoice)
 {
-    vector<clsBankClient> vClients = clsBankClient::getListVectorFromFile(ClientsDataFile);
     switch (transactionChoice)
     {
     case enTransactionChoice::Deposit:
     {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.deposit");
+        clsMetrics::clsScopedTimer timer(latency);
         clsDepositScreen::depositScreen();
         break;
     }
     case enTransactionChoice::Withdraw:
     {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.withdraw");
+        clsMetrics::clsScopedTimer timer(latency);
         clsWithdrawScreen::withdrawScreen();
         break;
     }
     case enTransactionChoice::TotalBalances:
     {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.totalBalances");
+        clsMetrics::clsScopedTimer timer(latency);
         clsBankClient::showTotalBalances();
         break;
     }
     case enTransactionChoice::Transfer:
     {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.transfer");
+        clsMetrics::clsScopedTimer timer(latency);
         clsTransferScreen::transferScreen();
         break;
     }
     case enTransactionChoice::ShowTransferRecordsList:
     {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.showTransferRecords");
+        clsMetrics::clsScopedTimer timer(latency);
         clsTransferListRecordScreen::showtransferRecordsList();
         break;
     }
+    case enTransactionChoice::BalanceReport:
+    {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.balanceReport");
+        clsMetrics::clsScopedTimer timer(latency);
+        clsBalanceReportScreen::showBalanceReport();
+        break;
+    }
+    case enTransactionChoice::PostInterest:
+    {
+        // credits every account at once: reserved for full-access users, like the metrics entry.
+        if (currentUser.getAccessValue() == -1)
+        {
+            static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.postInterest");
+            clsMetrics::clsScopedTimer timer(latency);
+            clsInterestPostingScreen::postInterestScreen();
+        }
+        else clsBankUser::printAccessDeniedMessage();
+        break;
+    }
+    case enTransactionChoice::Statements:
+    {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.statements");
+        clsMetrics::clsScopedTimer timer(latency);
+        clsStatementScreen::statementScreen();
+        break;
+    }
+    case enTransactionChoice::Reconcile:
+    {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.reconcile");
+        clsMetrics::clsScopedTimer timer(latency);
+        clsReconciliationScreen::reconciliationScreen();
+        break;
+    }
+    case enTransactionChoice::BalanceAsOf:
+    {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.balanceAsOf");
+        clsMetrics::clsScopedTimer timer(latency);
+        clsBalanceAsOfScreen::balanceAsOfScreen();
+        break;
+    }
+    case enTransactionChoice::TransferAnalytics:
+    {
+        static clsMetrics::clsHistogram & latency = clsMetrics::histogram("menu.transferAnalytics");
+        clsMetrics::clsScopedTimer timer(latency);
+        clsTransferAnalyticsScreen::transferAnalyticsScreen();
+        break;
+    }
     case enTransactionChoice::MainMenu:
     {
         clsMainScreen::showMainMenu();
@@ -59,7 +122,13 @@ void clsTransactionScreen::showTransactionsMenu()
     cout << setw(40) << "" << "\t[3] Total Balances.\n";
     cout << setw(40) << "" << "\t[4] Transfer.\n";
     cout << setw(40) << "" << "\t[5] Show Transaction Records List.\n";
-    cout << setw(40) << "" << "\t[6] Main Menu.\n";
+    cout << setw(40) << "" << "\t[6] Balance Report.\n";
+    cout << setw(40) << "" << "\t[7] Post Interest.\n";
+    cout << setw(40) << "" << "\t[8] Monthly Statements.\n";
+    cout << setw(40) << "" << "\t[9] Reconcile Ledger.\n";
+    cout << setw(40) << "" << "\t[10] Balance As Of Date.\n";
+    cout << setw(40) << "" << "\t[11] Transfer Analytics.\n";
+    cout << setw(40) << "" << "\t[12] Main Menu.\n";
     cout << setw(40) << "" << "============================================\n";
     _performTransactionsChoice((enTransactionChoice)_readTransactionsChoice());
 }
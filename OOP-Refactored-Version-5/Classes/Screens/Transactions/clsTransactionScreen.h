@@ -10,6 +10,12 @@
  * - Viewing total balances
  * - Transferring between accounts
  * - Viewing transfer records
+ * - Viewing the balance distribution report
+ * - Posting the end-of-day interest
+ * - Writing the monthly account statements
+ * - Reconciling the transfer log with the clients file
+ * - Looking up the balance of an account on a past date
+ * - Printing grouped reports of the transfer log
  * - Returning to the main menu
  *
  * ## Relationships
@@ -21,6 +27,12 @@
  *   - `clsWithdrawScreen` → Handles withdrawals.
  *   - `clsTransferScreen` → Handles transfers between accounts.
  *   - `clsTransferListRecordScreen` → Displays a list of transfer records.
+ *   - `clsBalanceReportScreen` → Displays the balance histogram and quantiles.
+ *   - `clsInterestPostingScreen` → Posts interest to every account.
+ *   - `clsStatementScreen` → Writes the monthly account statements.
+ *   - `clsReconciliationScreen` → Cross-checks the transfer log against the clients file.
+ *   - `clsBalanceAsOfScreen` → Shows the balance of an account on a past date.
+ *   - `clsTransferAnalyticsScreen` → Prints the transfer log reports.
  *   - `clsBankClient` → Provides balance overview and client data handling.
  *   - `clsMainScreen` → Allows navigation back to the main menu.
  *
@@ -52,14 +64,14 @@ private:
     /**
      * @brief Reads and validates the user's transaction menu choice.
      *
-     * Displays a prompt and ensures the choice is within the valid range (1–6).
+     * Displays a prompt and ensures the choice is within the valid range (1–12).
      *
      * @return short The validated transaction choice.
      */
     static short _readTransactionsChoice()
     {
-        cout << setw(30) << "" << "Choose What Do You Want to do? [1 to 6]? " ;
-        short choice = clsInputValidation::readShortNumberBetween(1, 6, "Choose a number between 1 and 6");
+        cout << setw(30) << "" << "Choose What Do You Want to do? [1 to 12]? " ;
+        short choice = clsInputValidation::readShortNumberBetween(1, 12, "Choose a number between 1 and 12");
         return choice;
     }
 
@@ -72,6 +84,12 @@ private:
      * - Total Balances
      * - Transfer
      * - Transfer Records List
+     * - Balance Report
+     * - Post Interest
+     * - Statements
+     * - Reconcile
+     * - Balance As Of
+     * - Transfer Analytics
      * - Main Menu
      *
      * @param transactionChoice The transaction option chosen by the user.
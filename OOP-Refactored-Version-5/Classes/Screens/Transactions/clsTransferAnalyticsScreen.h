@@ -0,0 +1,148 @@
+/**
+ * @file clsTransferAnalyticsScreen.h
+ * @brief Defines the `clsTransferAnalyticsScreen` class, which prints the transfer log reports.
+ *
+ * ## Overview
+ * Offers the ready-made `clsTransferAnalytics` reports (transfers per teller per hour, daily volume
+ * per account, largest transfers per day), optionally restricted to one month. Prints the first
+ * groups of the report as a table and exports every group as CSV to `TransferAnalyticsFile`.
+ *
+ * ## Relationships
+ * - **Inherits from:** `clsScreen` — for drawing the screen header.
+ * - **Uses:** `clsTransferAnalytics`.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include "../Misc/clsScreen.h"
+#include "../../Core/clsGlobal.h"
+#include "../../Core/clsTransferAnalytics.h"
+#include "../../Utils/clsInputValidation.h"
+#include "../../Utils/clsDate.h"
+#include "../../Utils/clsUtil.h"
+using namespace std;
+
+/**
+ * @class clsTransferAnalyticsScreen
+ * @brief Screen running one of the transfer log reports.
+ */
+class clsTransferAnalyticsScreen : protected clsScreen
+{
+private:
+    static const size_t _shownGroups = 30;
+    static const size_t _largestTransfersPerDay = 5;
+
+    static stTransferQuery _readQuery()
+    {
+        cout << "\n" << setw(8) << left << "" << "[1] Transfers per Teller per Hour.\n";
+        cout << setw(8) << left << "" << "[2] Daily Volume per Account.\n";
+        cout << setw(8) << left << "" << "[3] Largest Transfers per Day.\n";
+
+        cout << "\nChoose the report [1 to 3]? ";
+        short choice = clsInputValidation::readShortNumberBetween(1, 3, "Choose a number between 1 and 3");
+
+        stTransferQuery query = choice == 1 ? clsTransferAnalytics::tellerHourlyActivity()
+                              : choice == 2 ? clsTransferAnalytics::accountDailyVolume()
+                              : clsTransferAnalytics::largestTransfersPerDay(_largestTransfersPerDay);
+
+        char ans = clsUtil::confirm("Restrict the report to one month (Y/N)? ");
+        if (tolower(ans) == 'y')
+        {
+            clsDate today;
+
+            cout << "\nEnter the month [1 to 12]? ";
+            int month = clsInputValidation::readIntNumberBetween(1, 12, "Enter a Number from 1 to 12: ");
+
+            cout << "Enter the year [2000 to " << today.getYear() << "]? ";
+            int year = clsInputValidation::readIntNumberBetween(2000, today.getYear(), "Enter a Number from 2000 to " + to_string(today.getYear()) + ": ");
+
+            query.filter.fromKey = ((int64_t)year * 10000 + month * 100 + 1) * 1000000;
+            query.filter.toKey = clsDate::endOfDayKey(clsDate(clsDate::getMonthDays(year, month), month, year));
+        }
+
+        return query;
+    }
+
+    static void _printGroups(const stTransferQuery & query, const stTransferAnalyticsResult & result)
+    {
+        size_t shown = min(_shownGroups, result.vGroups.size());
+
+        cout << "\n" << setw(8) << left << "" << "First " << shown << " of " << result.vGroups.size() << " groups:" << endl;
+        cout << setw(8) << left << "" << "-----------------------------------------------------------------------------------------------------" << endl;
+        cout << setw(8) << left << "";
+        for (enTransferGroupKey groupKey : query.vGroupBy)
+            cout << "| " << left << setw(17) << clsTransferAnalytics::groupKeyLabel(groupKey) + ":";
+        cout << "| " << left << setw(8) << "Count:";
+        cout << "| " << left << setw(14) << "Sum:";
+        cout << "| " << left << setw(12) << "Min:";
+        cout << "| " << left << setw(12) << "Max:" << "|" << endl;
+        cout << setw(8) << left << "" << "-----------------------------------------------------------------------------------------------------" << endl;
+
+        cout << fixed << setprecision(2);
+        for (size_t i = 0; i < shown; i++)
+        {
+            const stTransferGroup & group = result.vGroups[i];
+
+            cout << setw(8) << left << "";
+            for (const string& part : group.vKey)
+                cout << "| " << left << setw(17) << part;
+            cout << "| " << left << setw(8) << group.count;
+            cout << "| " << left << setw(14) << group.sum;
+            cout << "| " << left << setw(12) << group.min;
+            cout << "| " << left << setw(12) << group.max << "|" << endl;
+
+            for (size_t rank = 0; rank < group.vTop.size(); rank++)
+            {
+                const stTopTransfer & transfer = group.vTop[rank];
+
+                cout << setw(10) << left << "" << "#" << rank + 1 << "  " << left << setw(22) << transfer.timestamp;
+                cout << left << setw(12) << transfer.sourceAccount << "-> " << left << setw(12) << transfer.destinationAccount;
+                cout << left << setw(12) << transfer.teller << right << setw(14) << transfer.amount << endl;
+            }
+        }
+        cout << defaultfloat;
+        cout << setw(8) << left << "" << "-----------------------------------------------------------------------------------------------------" << endl;
+    }
+
+    static void _exportCsv(const stTransferQuery & query, const stTransferAnalyticsResult & result)
+    {
+        fstream myFile;
+        myFile.open(TransferAnalyticsFile, ios::out);
+
+        if (!myFile.is_open())
+        {
+            cout << "\nCould not write [" << TransferAnalyticsFile << "]." << endl;
+            return;
+        }
+
+        clsTransferAnalytics::writeCsv(myFile, query, result);
+        myFile.close();
+
+        cout << "\nReport exported to [" << TransferAnalyticsFile << "]." << endl;
+    }
+
+public:
+    /**
+     * @brief Reads the report and the period, then prints and exports the report.
+     */
+    static void transferAnalyticsScreen()
+    {
+        _drawScreenHeader("\t  Transfer Analytics Screen");
+
+        stTransferQuery query = _readQuery();
+        stTransferAnalyticsResult result = clsTransferAnalytics::run(query);
+
+        cout << "\n" << setw(8) << left << "" << "Transfers Read     : " << result.recordsScanned << endl;
+        cout << setw(8) << left << "" << "Transfers Matched  : " << result.recordsMatched << endl;
+        cout << setw(8) << left << "" << "Malformed Records  : " << result.malformedRecords << endl;
+        cout << setw(8) << left << "" << "Time Taken         : " << result.milliseconds << " ms" << endl;
+
+        if (result.vGroups.empty())
+            cout << "\nNo transfers match the report." << endl;
+        else
+            _printGroups(query, result);
+
+        _exportCsv(query, result);
+    }
+};
@@ -44,21 +44,23 @@ using namespace std;
 class clsTransferListRecordScreen : protected clsScreen
 {
 private:
-    static void _printTransferRecordData(clsTransferRecord transferRecord)
+    static void _printTransferRecordData(const stTransferRecordView & transferRecord)
     {
-        cout << setw(10) << left << "" << "| " << setw(20) << left << transferRecord.getLoginTimeRecord();
-        cout << "| " << setw(16) << left << transferRecord.getSourceAccountNumber();
-        cout << "| " << setw(16) << left << transferRecord.getDestinationAccountNumber();
-        cout << "| " << setw(7) << left << transferRecord.getAmount();
-        cout << "| " << setw(17) << left << transferRecord.getSourceAccountBalance();
-        cout << "| " << setw(17) << left << transferRecord.getDestinationAccountBalance();
-        cout << "| " << setw(12) << left << transferRecord.getUserName() << "|";
+        cout << setw(10) << left << "" << "| " << setw(20) << left << transferRecord.loginTimeRecord;
+        cout << "| " << setw(16) << left << transferRecord.sourceAccountNumber;
+        cout << "| " << setw(16) << left << transferRecord.destinationAccountNumber;
+        cout << "| " << setw(7) << left << transferRecord.amount;
+        cout << "| " << setw(17) << left << transferRecord.sourceAccountBalance;
+        cout << "| " << setw(17) << left << transferRecord.destinationAccountBalance;
+        cout << "| " << setw(12) << left << transferRecord.userName << "|";
     }
 
 public:
     static void showtransferRecordsList()
     {
-        vector <clsTransferRecord> vTransfers = clsTransferRecord::getTransferRecordsVector(TransferLogsFile);
+        clsLogScanner::stScanStats scanStats;
+        clsArena arena;
+        clsArenaVector <stTransferRecordView> vTransfers = clsTransferRecord::getTransferRecordViews(TransferLogsFile, arena, &scanStats);
 
         string title = "\tTransfer Records List Screen";
         string subTitle = "\t      Transfers List (" + to_string(vTransfers.size()) + "):";
@@ -79,11 +81,13 @@ public:
             cout << "\t\t\tNo Data Available in the System" << endl;
         }
 
-        for (clsTransferRecord & transfer : vTransfers)
+        for (const stTransferRecordView & transfer : vTransfers)
         {
             _printTransferRecordData(transfer);
             cout << endl;
         }
         cout << setw(10) << left << "" <<  "------------------------------------------------------------------------------------------------------------------------" << endl;
+        cout << setw(10) << left << "" << "Scanned " << scanStats.records << " records in " << (long long)(scanStats.seconds * 1000000)
+             << " us (" << (long long)scanStats.getRecordsPerSecond() << " records/s)." << endl;
     }
 };
@@ -27,6 +27,8 @@
 #include "../../Core/clsBankUser.h"
 #include "../../Core/clsBankClient.h"
 #include "../../Utils/clsDate.h"
+#include "../../Utils/clsMetrics.h"
+#include "../../Utils/clsTracer.h"
 using namespace std;
 
 /**
@@ -93,6 +95,10 @@ private:
      */
     static void _saveTransferRecordIntoFile(string & fileName, const clsBankClient & sourceClientData, const clsBankClient & destinationClientData, double amount)
     {
+        static clsMetrics::clsHistogram & appendLatency = clsMetrics::histogram("transfer.logAppend");
+        clsMetrics::clsScopedTimer timer(appendLatency);
+        clsTraceSpan span("clsTransferLogger::_saveTransferRecordIntoFile");
+
         fstream myFile;
         string transferRecord = _returnTransferRecordData(sourceClientData, destinationClientData, amount);
 
@@ -9,11 +9,19 @@
  *
  * It also provides static helper methods for:
  * - Converting stored records into `clsTransferRecord` objects.
- * - Loading all transfer records from a file.
+ * - Loading all transfer records from a file (in parallel, via `clsLogScanner`), or streaming them to a visitor.
+ * - Loading them as arena-aware `stTransferRecordView`s, for screens that only print them, or parsing
+ *   a single line into one (`parseTransferRecordView()`), for scans that only read a few fields.
+ * - Sorting the transfer record file by account, timestamp or amount, however large it is (`clsExternalSorter`).
  * - Clearing the transfer record file.
  *
+ * Both account numbers of a record are also kept as packed `clsAccountKey`s, so reports can
+ * group, join and sort transfers by account with integer compares and hashes.
+ *
  * ## Relationships
  * - **Uses `clsString`:** for splitting record lines when reading from files.
+ * - **Uses `clsLogScanner`:** to parse the log in parallel chunks, in file order.
+ * - **Uses `clsExternalSorter`:** to sort the log on disk by one of the `enTransferSortKey` fields.
  * - **Interacts with the filesystem:** (`fstream`) to persist transfer history.
  *
  * ## Key Responsibilities
@@ -25,9 +33,29 @@
 #pragma once
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include "../../Utils/clsString.h"
+#include "../../Utils/clsMetrics.h"
+#include "../../Utils/clsTracer.h"
+#include "../../Utils/clsLogScanner.h"
+#include "../../Utils/clsArena.h"
+#include "../../Utils/clsExternalSorter.h"
+#include "../../Utils/clsDate.h"
+#include "../../Core/clsAccountKey.h"
+#include "../../Core/clsEnums.h"
 using namespace std;
 
+/**
+ * @struct stTransferRecordView
+ * @brief An arena-aware transfer record: the text fields view the log bytes held by a `clsArena`.
+ */
+struct stTransferRecordView
+{
+    string_view loginTimeRecord, sourceAccountNumber, destinationAccountNumber, userName;
+    float amount = 0, sourceAccountBalance = 0, destinationAccountBalance = 0;
+    clsAccountKey sourceAccountKey, destinationAccountKey;
+};
+
 /**
  * @class clsTransferRecord
  * @brief Represents a single transfer record and provides utilities for persistence.
@@ -41,6 +69,7 @@ class clsTransferRecord
 private:
     string _loginTimeRecord, _sourceAccountNumber, _destinationAccountNumber, _userName;
     float _amount, _sourceAccountBalance, _destinationAccountBalance;
+    clsAccountKey _sourceAccountKey, _destinationAccountKey;
 
     /**
      * @brief Converts a serialized transfer record string into a `clsTransferRecord` object.
@@ -61,33 +90,50 @@ private:
     /**
      * @brief Loads all transfer records from a file into a vector.
      *
-     * Reads the specified file line by line, converts each line into a `clsTransferRecord`,
-     * and stores them in a vector.
+     * The file is parsed in parallel, newline-aligned chunks by `clsLogScanner`;
+     * the records keep their file order.
      *
      * @param fileName The file containing transfer records.
+     * @param stats Optional; receives the record count and the scan speed.
      * @return vector<clsTransferRecord> A vector of transfer records loaded from the file.
      */
-    static vector <clsTransferRecord> _loadTransferRecordFileIntoVector(string fileName)
+    static vector <clsTransferRecord> _loadTransferRecordFileIntoVector(string fileName, clsLogScanner::stScanStats * stats = nullptr)
     {
-        vector <clsTransferRecord> vTransfers;
-
-        fstream myFile;
-        myFile.open(fileName, ios::in);
+        static clsMetrics::clsHistogram & loadLatency = clsMetrics::histogram("transfer.load");
+        clsMetrics::clsScopedTimer timer(loadLatency);
+        clsTraceSpan span("clsTransferRecord::_loadTransferRecordFileIntoVector");
 
-        if (myFile.is_open())
-        {
-            string line;
+        return clsLogScanner::readAll<clsTransferRecord>(fileName,
+            [](const string& line) { return _convertTransferRecordIntoObject(line); }, stats);
+    }
 
-            while(getline(myFile, line))
-            {
-                clsTransferRecord transferRecord = _convertTransferRecordIntoObject(line);
+    /**
+     * @brief Returns one field of a log line without splitting the rest of it.
+     */
+    static string_view _logField(string_view line, size_t field)
+    {
+        string_view arFields[7];
+        return clsString::splitView(line, arFields, field + 1, "#//#") == field + 1 ? arFields[field] : string_view();
+    }
 
-                vTransfers.push_back(transferRecord);
-            }
-            myFile.close();
+    /**
+     * @brief Calls `action(keyOf)` with the key extractor of a sort key.
+     */
+    template <typename Action>
+    static bool _withSortKey(enTransferSortKey sortKey, Action action)
+    {
+        switch (sortKey)
+        {
+        case enTransferSortKey::SourceAccount:
+            return action([](string_view line) { return _logField(line, 1); });
+        case enTransferSortKey::DestinationAccount:
+            return action([](string_view line) { return _logField(line, 2); });
+        case enTransferSortKey::Timestamp:
+            return action([](string_view line) { return clsDate::timestampKey(_logField(line, 0)); });
+        case enTransferSortKey::Amount:
+            return action([](string_view line) { return clsString::parseDouble(_logField(line, 3)); });
         }
-
-        return vTransfers;
+        return false;
     }
 
 public:
@@ -110,6 +156,8 @@ public:
         _destinationAccountBalance = destinationAccountBalance;
         _sourceAccountNumber = sourceAccountNumber;
         _destinationAccountNumber = destinationAccountNumber;
+        _sourceAccountKey = clsAccountKey(_sourceAccountNumber);
+        _destinationAccountKey = clsAccountKey(_destinationAccountNumber);
         _amount = amount;
         _userName = userName;
     }
@@ -123,6 +171,14 @@ public:
         return _sourceAccountNumber;
     }
 
+    /**
+     * @brief Gets the source account number packed into a 64-bit key.
+     */
+    clsAccountKey getSourceAccountKey() const
+    {
+        return _sourceAccountKey;
+    }
+
     /**
      * @brief Gets the balance of the source account after the transfer.
      * @return float The source account balance.
@@ -142,6 +198,14 @@ public:
         return _destinationAccountNumber;
     }
 
+    /**
+     * @brief Gets the destination account number packed into a 64-bit key.
+     */
+    clsAccountKey getDestinationAccountKey() const
+    {
+        return _destinationAccountKey;
+    }
+
     /**
      * @brief Gets the balance of the destination account after the transfer.
      * @return float The destination account balance.
@@ -183,11 +247,101 @@ public:
      * @brief Loads all transfer records from a given file into a vector.
      *
      * @param fileName The file containing transfer records.
+     * @param stats Optional; receives the record count and the scan speed.
      * @return vector<clsTransferRecord> A vector of transfer record objects.
      */
-    static vector <clsTransferRecord> getTransferRecordsVector(string fileName)
+    static vector <clsTransferRecord> getTransferRecordsVector(string fileName, clsLogScanner::stScanStats * stats = nullptr)
+    {
+        return _loadTransferRecordFileIntoVector(fileName, stats);
+    }
+
+    /**
+     * @brief Streams the transfer records of a file to a visitor, in file order, without keeping them all in memory.
+     *
+     * @param fileName The file containing transfer records.
+     * @param visit Called once per record, on the calling thread.
+     * @return The record count and the scan speed.
+     */
+    static clsLogScanner::stScanStats forEachTransferRecord(string fileName, const function<void(clsTransferRecord &)> & visit)
     {
-        return _loadTransferRecordFileIntoVector(fileName);
+        return clsLogScanner::forEach<clsTransferRecord>(fileName,
+            [](const string& line) { return _convertTransferRecordIntoObject(line); }, visit);
+    }
+
+    /**
+     * @brief Loads all transfer records into an arena, as views of the log bytes.
+     *
+     * The whole load is a few arena allocations (the file bytes and the record array),
+     * and everything is released at once with the arena.
+     *
+     * @param fileName The file containing transfer records.
+     * @param arena The arena holding the records; they must not outlive it.
+     * @param stats Optional; receives the record count and the scan speed.
+     */
+    static clsArenaVector <stTransferRecordView> getTransferRecordViews(string fileName, clsArena & arena, clsLogScanner::stScanStats * stats = nullptr)
+    {
+        static clsMetrics::clsHistogram & loadLatency = clsMetrics::histogram("transfer.load");
+        clsMetrics::clsScopedTimer timer(loadLatency);
+        clsTraceSpan span("clsTransferRecord::getTransferRecordViews");
+
+        return clsLogScanner::readAllViews<stTransferRecordView>(fileName, arena,
+            [](string_view line) { return parseTransferRecordView(line); }, stats);
+    }
+
+    /**
+     * @brief Parses one log line into a view of its fields, without copying them.
+     *
+     * The view must not outlive `line`. A malformed line gives an empty view (no account numbers).
+     */
+    static stTransferRecordView parseTransferRecordView(string_view line)
+    {
+        string_view arFields[7];
+        stTransferRecordView record;
+
+        if (clsString::splitView(line, arFields, 7, "#//#") == 7)
+        {
+            record = {arFields[0], arFields[1], arFields[2], arFields[6], (float)clsString::parseDouble(arFields[3]),
+                      (float)clsString::parseDouble(arFields[4]), (float)clsString::parseDouble(arFields[5]),
+                      clsAccountKey(arFields[1]), clsAccountKey(arFields[2])};
+        }
+        return record;
+    }
+
+    /**
+     * @brief Writes the transfer records of a file to another file, sorted on disk by one field.
+     *
+     * Records with equal keys keep their log order. The log can be far larger than memory:
+     * only `memoryBudget` bytes of it are sorted in memory at a time.
+     *
+     * @param fileName The file containing transfer records.
+     * @param sortedFileName The file receiving the sorted records (replaced if it exists).
+     * @param sortKey The field to sort by.
+     * @param memoryBudget The bytes of the log sorted in memory at a time.
+     * @param stats Optional; receives the number of records and runs and the time of each phase.
+     * @return false when the log cannot be read or the sorted file cannot be written.
+     */
+    static bool sortTransferRecords(const string& fileName, const string& sortedFileName, enTransferSortKey sortKey,
+                                    size_t memoryBudget = clsExternalSorter::defaultMemoryBudget, stExternalSortStats * stats = nullptr)
+    {
+        clsTraceSpan span("clsTransferRecord::sortTransferRecords");
+
+        return _withSortKey(sortKey, [&](auto keyOf)
+        {
+            return clsExternalSorter::sortFile(fileName, sortedFileName, keyOf, memoryBudget, stats);
+        });
+    }
+
+    /**
+     * @brief Returns whether the transfer records of a file are ordered by one field.
+     *
+     * @param recordCount Optional; receives the number of records.
+     */
+    static bool isTransferRecordFileSorted(const string& fileName, enTransferSortKey sortKey, uint64_t * recordCount = nullptr)
+    {
+        return _withSortKey(sortKey, [&](auto keyOf)
+        {
+            return clsExternalSorter::isSorted(fileName, keyOf, recordCount);
+        });
     }
 
     /**
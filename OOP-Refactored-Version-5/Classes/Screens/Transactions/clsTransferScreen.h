@@ -30,6 +30,7 @@
 #include "clsWithdrawScreen.h"
 #include "clsTransactionHelper.h"
 #include "clsTransferLogger.h"
+#include "../../Utils/clsTracer.h"
 using namespace std;
 
 /**
@@ -57,22 +58,31 @@ public:
      * - Prompts for and validates a transfer amount (via `clsWithdrawScreen`).
      * - Executes the transfer using `clsTransactionHelper`.
      * - Prints updated account details for both accounts.
-     * - Logs the transfer to a file (`Transfer.txt`) using `clsTransferLogger`.
+     * - Logs the confirmed transfer to `TransferLogsFile` using `clsTransferLogger`.
      */
     static void transferScreen()
     {
-        _drawScreenHeader("\t\t Transfer Screen");
+        clsTraceSpan span("clsTransferScreen::transferScreen");
 
-        vector<clsBankClient> vClients = clsBankClient::getListVectorFromFile(ClientsDataFile);
+        _drawScreenHeader("\t\t Transfer Screen");
 
+        // the two records are copied out of the repository cache, changed, and saved as one batch.
         cout << "Transfer From Account:- " << endl;
         string transferFromAccountNumber = clsBankClient::readAccountNumber(enStatus::Exist);
-        clsBankClient &transferFromAccount = clsBankClient::findClientRef(transferFromAccountNumber, vClients);
+        clsBankClient transferFromAccount = clsBankClient::findClient(transferFromAccountNumber);
         clsPrintPersonCard::printTransferClientInfo(transferFromAccount);
 
         cout << "Transfer To Account:- " << endl;
         string transferToAccountNumber = clsBankClient::readAccountNumber(enStatus::Exist);
-        clsBankClient &transferToAccount = clsBankClient::findClientRef(transferToAccountNumber, vClients);
+
+        // two copies of one record would both be saved, the credit overwriting the debit.
+        while (transferToAccountNumber == transferFromAccountNumber)
+        {
+            cout << "\nCannot transfer to the same account, choose another one.\n";
+            transferToAccountNumber = clsBankClient::readAccountNumber(enStatus::Exist);
+        }
+
+        clsBankClient transferToAccount = clsBankClient::findClient(transferToAccountNumber);
         clsPrintPersonCard::printTransferClientInfo(transferToAccount);
 
         double transferAmount = 0;
@@ -80,11 +90,12 @@ public:
         cout << "Enter Transfer Amount: ";
         transferAmount = clsWithdrawScreen::getValidWithdrawAmount(transferFromAccount);
 
-        clsTransactionHelper::transferAmountBetweenTwoAccounts(transferAmount, vClients, transferFromAccount, transferToAccount);
+        bool transferred = clsTransactionHelper::transferAmountBetweenTwoAccounts(transferAmount, transferFromAccount, transferToAccount);
 
         clsPrintPersonCard::printTransferClientInfo(transferFromAccount);
         clsPrintPersonCard::printTransferClientInfo(transferToAccount);
 
-        clsTransferLogger::registerTransferIntoFile("Transfer.txt", transferFromAccount, transferToAccount, transferAmount);
+        if (transferred)
+            clsTransferLogger::registerTransferIntoFile(TransferLogsFile, transferFromAccount, transferToAccount, transferAmount);
     }
 };
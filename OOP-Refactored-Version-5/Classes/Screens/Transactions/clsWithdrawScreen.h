@@ -13,7 +13,7 @@
  *
  * - **Uses**:
  *  -`clsBankClient`:
- *   → Loads clients from the data file.
+ *   → Finds the client record in the repository cache.
  *   → Validates that the account exists.
  *   → Retrieves and updates the client’s account balance.
  *
@@ -24,15 +24,14 @@
  *   → Ensures the withdrawal amount entered is a valid numeric value.
  *
  *  -`clsTransactionHelper`:
- *   → Executes the withdrawal operation (negative transaction) and persists updated records.
+ *   → Executes the withdrawal operation (negative transaction) and persists the updated record.
  *
  * ## Workflow
  * 1. Displays the withdrawal screen header.
- * 2. Loads the list of clients from file.
- * 3. Prompts for and validates an existing account number.
- * 4. Locates the client reference and displays client details.
- * 5. Reads and validates the withdrawal amount against available balance.
- * 6. Performs the withdrawal and updates records via `clsTransactionHelper`.
+ * 2. Prompts for and validates an existing account number.
+ * 3. Copies the matching client record and displays client details.
+ * 4. Reads and validates the withdrawal amount against available balance.
+ * 5. Performs the withdrawal and saves that single record via `clsTransactionHelper`.
  */
 
 #pragma once
@@ -84,21 +83,19 @@ public:
      * @brief Handles the full withdrawal workflow.
      *
      * - Draws the withdrawal screen header.
-     * - Loads clients from file.
      * - Prompts for and validates account number.
+     * - Copies the client record out of the repository cache.
      * - Displays client information.
      * - Validates and reads withdrawal amount.
      * - Updates client balance and saves data.
      */
     static void withdrawScreen()
     {
-        vector<clsBankClient> vClients = clsBankClient::getListVectorFromFile(ClientsDataFile);
-
         _drawScreenHeader("\t\t Withdraw Screen");
 
         string accountNumber = clsBankClient::readAccountNumber(enStatus::Exist);
 
-        clsBankClient &client = clsBankClient::findClientRef(accountNumber, vClients);
+        clsBankClient client = clsBankClient::findClient(accountNumber);
         clsPrintPersonCard::printClientInfo(client);
 
         double withdrawAmount = 0;
@@ -107,6 +104,6 @@ public:
 
         withdrawAmount = getValidWithdrawAmount(client);
 
-        clsTransactionHelper::makeTransaction(-withdrawAmount, vClients, client);
+        clsTransactionHelper::makeTransaction(-withdrawAmount, client);
     }
 };
@@ -63,12 +63,11 @@ public:
      * @brief Displays the "Add New User" screen and executes the user creation workflow.
      *
      * ## Workflow
-     * - Reads the list of existing users from file.
      * - Displays the "Add New User" header screen.
      * - Prompts for a new, unique username.
      * - Creates a new `clsBankUser` object for the provided username.
      * - Allows modification of the new user’s details.
-     * - Saves the updated list of users into persistent storage.
+     * - Appends the new user record to persistent storage.
      * - Prints the newly created user’s details.
      *
      * @note This method reuses the generic workflow provided by
@@ -81,10 +80,11 @@ public:
             UsersDataFile,
             "\tAdd New User Info Scree",
             "\nUser Added Successfully.",
+            "\nAdd Failed, This User Name Was Added Meanwhile.",
             clsBankUser::readUserName,
             clsBankUser::_getAddUserObject,
             clsBankUser::_changeUserRecord,
-            clsBankUser::_saveUserDataIntoFile,
+            clsBankUser::addUserRecord,
             clsPrintPersonCard::printUserInfo
         );
 
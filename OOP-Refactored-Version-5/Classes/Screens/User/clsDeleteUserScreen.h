@@ -61,14 +61,13 @@ public:
      * @brief Displays the "Delete User" screen and executes the deletion workflow.
      *
      * ## Workflow
-     * - Loads all users from file.
      * - Displays the "Delete User Info Screen" header.
      * - Prompts for an existing username.
      * - Finds and displays the user record to be deleted.
      * - Asks the operator for confirmation.
      * - If confirmed:
      *   - Marks the user as deleted using `_markUserDeleteSign`.
-     *   - Saves the updated user list to persistent storage.
+     *   - Persists only that deletion to storage.
      *   - Replaces the deleted object with an empty user.
      *   - Displays a success message.
      *
@@ -77,13 +76,11 @@ public:
      */
     static void deleteUserScreen()
     {
-        vector<clsBankUser> vUsers = clsBankUser::getListVectorFromFile(UsersDataFile);
-
         _drawScreenHeader("\t Delete User Info Screen");
 
         string userName = clsBankUser::readUserName(enStatus::Exist);
 
-        clsBankUser &userToBeDeleted = clsBankUser::findUserRef(userName, vUsers);
+        clsBankUser userToBeDeleted = clsBankUser::findUser(userName);
 
         clsPrintPersonCard::printUserInfo(userToBeDeleted);
 
@@ -92,7 +89,7 @@ public:
         if (tolower(ans) == 'y')
         {
             clsBankUser::_markUserDeleteSign(userToBeDeleted);
-            clsBankUser::_saveUserDataIntoFile(UsersDataFile, vUsers);
+            clsBankUser::saveUserRecord(UsersDataFile, userToBeDeleted);
             userToBeDeleted = clsBankUser::_getEmptyUserObject();
             cout << "\nUser Deleted Successfully." << endl;
         }
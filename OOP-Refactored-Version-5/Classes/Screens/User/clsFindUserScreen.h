@@ -70,7 +70,6 @@ public:
     {
         findEntityScreen
         (
-            ClientsDataFile,
             "\t Find User Info Screen",
             clsBankUser::readUserName,
             clsBankUser::findUser,
@@ -43,7 +43,7 @@ using namespace std;
  * that sensitive accounts (like Admin) cannot be altered.
  *
  * ## Responsibilities
- * - Load users from persistent storage.
+ * - Copy the target user out of the repository cache.
  * - Verify the target user exists.
  * - Disallow updates to restricted accounts.
  * - Update user details and persist changes.
@@ -57,7 +57,6 @@ public:
      * @brief Displays the "Update User" screen and executes the update workflow.
      *
      * ## Workflow
-     * - Loads all users from file.
      * - Displays the "Update User Info Screen" header.
      * - Prompts for an existing username.
      * - Restricts update if the username is `"Admin"`.
@@ -78,10 +77,10 @@ public:
             "\tUpdate User Info Screen",
             "\nUser Updated Successfully.\n",
             clsBankUser::readUserName,
-            clsBankUser::findUserRef,
+            clsBankUser::findUser,
             clsPrintPersonCard::printUserInfo,
             clsBankUser::_changeUserRecord,
-            clsBankUser::_saveUserDataIntoFile
+            clsBankUser::saveUserRecord
         );
         // vector<clsBankUser> vUsers = clsBankUser::getListVectorFromFile(UsersDataFile);
 
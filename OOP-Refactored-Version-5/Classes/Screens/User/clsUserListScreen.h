@@ -54,23 +54,25 @@ using namespace std;
 class clsUserListScreen : protected clsScreen
 {
 private:
-    static void _printUserData(clsBankUser userData)
+    static void _printUserData(const stUserView & userData)
     {
-        cout << setw(5) << left << "" << "| " << setw(17) << left << userData.getUserName();
+        cout << setw(5) << left << "" << "| " << setw(17) << left << userData.userName;
         // string userPassword = clsBankUser::encryptPassword(userData.getPassword());
         // cout << "| " << setw(15) << left << userPassword;
         // cout << "| " << setw(15) << left << userData.getPassword();
         cout << "| " << setw(15) << left << "****";
-        cout << "| " << setw(20) << left << userData.FullName();
-        cout << "| " << setw(15) << left << userData.getPhone();
-        cout << "| " << setw(27) << left << userData.getEmail();
-        cout << "| " << setw(14) << left << userData.getAccessValue() << "|";
+        // "first last" padded to 20 columns, without building the full name string.
+        cout << "| " << userData.firstName << ' ' << setw(19 - (int)userData.firstName.size()) << left << userData.lastName;
+        cout << "| " << setw(15) << left << userData.phone;
+        cout << "| " << setw(27) << left << userData.email;
+        cout << "| " << setw(14) << left << userData.accessValue << "|";
     }
 
 public:
     static void showUsersList()
     {
-        vector<clsBankUser> vUsers = clsBankUser::getListVectorFromFile(UsersDataFile);
+        clsArena arena;
+        clsArenaVector <stUserView> vUsers = clsBankUser::getUserViews(UsersDataFile, arena);
 
         string title = "\t\tUsers List Screen";
         string subTitle = "\t\tUsers List (" + to_string(vUsers.size()) + "):";
@@ -90,7 +92,7 @@ public:
             cout << "\t\t\tNo Data Available in the System" << endl;
         }
 
-        for (clsBankUser &user : vUsers)
+        for (const stUserView & user : vUsers)
         {
             _printUserData(user);
             cout << endl;
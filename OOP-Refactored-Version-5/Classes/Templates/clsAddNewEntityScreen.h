@@ -11,8 +11,8 @@
  * - Template-based design for flexibility (`EntityType` can be any class that supports the required methods).
  * - Reads a unique key for the new entity.
  * - Creates, modifies, and saves the entity.
- * - Automatically persists the updated entity list to a file.
- * - Prints confirmation and entity details after saving.
+ * - Appends only the new entity record to the file.
+ * - Prints confirmation and entity details after saving, or the failure when the key was taken meanwhile.
  *
  * ### Relationships:
  * - **Inherits from:** `clsScreen` — for drawing screen headers and providing
@@ -33,8 +33,7 @@ using namespace std;
  * @tparam EntityType The type of the entity to be added (e.g., `clsBankClient`, `clsUser`).
  *
  * This class inherits from `clsScreen` to reuse the standard screen header.
- * It expects the entity type to implement certain functions such as `getListVectorFromFile()`
- * and `setToUpdateMode()`.
+ * It expects the entity type to implement `setToUpdateMode()`.
  */
 template <typename EntityType>
 class clsAddNewEntityScreen : protected clsScreen
@@ -48,34 +47,32 @@ public:
      * @param readUniqueKey Function pointer to read a unique key for the entity (takes `enStatus`).
      * @param getAddObject Function pointer that creates and returns a new entity object given a unique key.
      * @param changeRecord Function pointer to modify the newly created entity (e.g., fill in details).
-     * @param saveData Function pointer to save the updated list of entities to the file.
+     * @param failureMessage The message printed when the record could not be appended.
+     * @param appendRecord Function pointer to append the new entity record to the file; returns false
+     *        if a record with the same key exists (e.g. added by another session after the key was read).
      * @param printInfo Function pointer to print the entity’s details after adding.
      *
      * ### Workflow:
-     * 1. Loads the current list of entities from the file.
-     * 2. Displays the screen header.
-     * 3. Reads the unique key for the new entity.
-     * 4. Creates a new entity object with the key.
-     * 5. Updates entity data through `changeRecord`.
-     * 6. Sets entity mode to update before saving.
-     * 7. Appends the new entity to the list.
-     * 8. Saves the updated list back to the file.
-     * 9. Prints a success message and entity details.
+     * 1. Displays the screen header.
+     * 2. Reads the unique key for the new entity.
+     * 3. Creates a new entity object with the key.
+     * 4. Updates entity data through `changeRecord`.
+     * 5. Sets entity mode to update before saving.
+     * 6. Appends the new entity record to the file.
+     * 7. Prints a success message and entity details, or the failure message.
      */
     static void addNewEntityScreen(
         const string& fileName,                                       // path to entity file
         const string& headerTitle,                                    // Header to display
-        const string& successMessage,                                 // Header to display
+        const string& successMessage,                                 // Printed after the append
+        const string& failureMessage,                                 // Printed if the append failed
         string (*readUniqueKey)(enStatus),                            // Function to read key
         EntityType (*getAddObject)(const string &),                   // Function to create new object
         void (*changeRecord)(EntityType &),                           // Function to modify data
-        void (*saveData)(const string &, const vector<EntityType> &), // Save function
-        void (*printInfo)(EntityType)                                 // Print function
+        bool (*appendRecord)(const string &, const EntityType &),     // Append function
+        void (*printInfo)(const EntityType &)                         // Print function
     )
     {
-        // Load existing entities
-        vector<EntityType> entities = EntityType::getListVectorFromFile(fileName);
-
         // Draw header
         _drawScreenHeader(headerTitle);
 
@@ -91,11 +88,12 @@ public:
         // Set mode to update before saving
         newEntity.setToUpdateMode();
 
-        // Add to the list
-        entities.push_back(newEntity);
-
-        // Save updated list
-        saveData(fileName, entities);
+        // Append only the new record
+        if (!appendRecord(fileName, newEntity))
+        {
+            cout << failureMessage;
+            return;
+        }
 
         // print the successful message indicating the new entity has been added.
         cout << successMessage;
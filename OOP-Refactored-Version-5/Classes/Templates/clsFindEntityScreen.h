@@ -12,20 +12,18 @@ public:
 
     static void findEntityScreen
     (
-        const string& fileName,
         const string& headerTitle,
         string (*readUniqueKey)(enStatus),
-        EntityType (*findEntity)(const string&),
-        void (*printInfo)(EntityType)
+        const EntityType & (*findEntity)(const string&),
+        void (*printInfo)(const EntityType &)
     )
     {
-        vector <EntityType> vEntities = EntityType::getListVectorFromFile(fileName);
-
         _drawScreenHeader(headerTitle);
 
         string uniqueKey = readUniqueKey(enStatus::Exist);
 
-        EntityType entityFound = findEntity(uniqueKey);
+        // the entity is printed straight from the repository cache, without a copy.
+        const EntityType & entityFound = findEntity(uniqueKey);
 
         if (!entityFound.isEmpty())
         {
@@ -0,0 +1,1115 @@
+/**
+ * @file clsRepository.h
+ * @brief Template repository providing cached loading, keyed lookup and dirty tracking for file-backed entities.
+ *
+ * ## Overview
+ * `clsBankClient` and `clsBankUser` are both stored as one `#//#` separated line per record and
+ * used to each carry their own copy of the load / save / find logic. `clsRepository` holds that
+ * logic once for any entity type:
+ * - **Cached loading** — a data file is parsed once and kept in memory; it is only re-read when
+ *   its modification time or size changed on disk (e.g. another terminal wrote it).
+ * - **Keyed indexing** — records are indexed by their unique key (account number, user name),
+ *   so a lookup is a hash probe instead of a file scan.
+ * - **Dirty tracking** — only records that really changed are marked dirty, and the file is not
+ *   touched at all when a save changed nothing.
+ * - **Incremental persistence** — a commit appends the dirty and deleted records to a journal
+ *   next to the data file (`Clients.txt.journal`) instead of rewriting the whole file, so a
+ *   single-record edit writes one line.
+ * - **Background checkpoints** — a checkpointer thread folds the journal into a fresh data file
+ *   (written to a temporary file, then atomically renamed over the old one), which also drops the
+ *   deleted records for good, and then discards the journal.
+ * - **Bloom filter fast path** — a persisted Bloom filter over the keys (`Clients.txt.bloom`)
+ *   answers most "does this key exist?" checks for a new account number / user name with
+ *   "definitely not" in nanoseconds, without loading or even stat-ing the data file; only a
+ *   "maybe" falls back to the exact key index.
+ * - **Append-only adds** — `append()` adds a new record by appending one committed entry to the
+ *   journal and updating the key index, so adding N records costs N appends instead of N full rewrites.
+ * - **Running totals** — aggregates over the records (`KeyTraits::Totals`, e.g. the bank-wide
+ *   balance of the clients) are adjusted by every insert, replace and remove, so reading them is
+ *   O(1); they are checkpointed to `Clients.txt.totals` and can be verified against a full recompute.
+ * - **Bulk rewrites** — `rewriteAll()` changes every record in parallel (e.g. posting interest to the
+ *   whole client book) and persists them all with one durable commit: a fresh data file, fsync-ed and
+ *   atomically renamed over the old one, instead of one journal entry per record.
+ *
+ * ## Journal Format
+ * One entry per line, using the same `#//#` separator as the data files:
+ * ```
+ * U#//#<serialized record>     upsert (insert or replace the record with the same key)
+ * D#//#<key>                   delete
+ * C                            commit: the entries above it form one batch
+ * ```
+ * Replaying an entry twice gives the same result, so a journal can always be replayed from the start.
+ *
+ * ## Entity Traits
+ * Serialization is specialized at compile time per entity through `clsEntityTraits<EntityType>`,
+ * declared right after each entity class:
+ * ```cpp
+ * template <>
+ * struct clsEntityTraits<clsBankClient>
+ * {
+ *     static const char * name();                          // metric prefix, e.g. "client"
+ *     static string key(const clsBankClient & client);     // unique key of a record
+ *     using IndexKey = clsAccountKey;                      // how the key index stores a key
+ *     static IndexKey indexKey(string_view key);           // key → index key
+ *     static IndexKey indexKey(const clsBankClient & client);
+ *     static bool probeKey(string_view key, IndexKey & indexKey); // lookup key, no side effects;
+ *                                                                 // false: no stored record has it
+ *     using Totals = clsBalanceTotals;                     // running aggregates (stNoTotals: none)
+ *     static void addToTotals(Totals & totals, const clsBankClient & client);
+ *     static void removeFromTotals(Totals & totals, const clsBankClient & client);
+ *     static clsBankClient fromLine(const string & line);  // parse one file line
+ *     static string toLine(const clsBankClient & client);  // serialize one record
+ * };
+ * ```
+ *
+ * ## Relationships
+ * - Used by **`clsBankClient`** and **`clsBankUser`** for every read and write of their data files.
+ * - Records its load / save latency into **`clsMetrics`** (`<name>.load`, `<name>.save`).
+ *
+ * ## Notable Implementation Details
+ * - There is one repository per data file (`clsRepository<...>::open(fileName)`), living until the program ends.
+ * - Records whose delete sign is set are dropped from the repository when saved.
+ * - A batch is only applied on load when its `C` line made it to disk, so a crash in the middle of
+ *   an append (e.g. between the two records of a transfer) never leaves half a batch applied.
+ * - A checkpoint is triggered once the journal grows past 64 KB or the data file size, or every
+ *   30 seconds while a journal exists. It first *rotates* the journal (`.journal` → `.journal.old`)
+ *   so new commits keep appending while the new data file is written; a load replays the data file,
+ *   then `.journal.old`, then `.journal`, so a crash at any point of a checkpoint loses nothing.
+ * - The checkpointer never waits for the repository lock: if a foreground operation (e.g. a deposit)
+ *   holds it, or a batch is half built, the checkpoint is retried a little later. Only the in-memory
+ *   snapshot and the final rename and bookkeeping run under the lock; the file write does not. The new
+ *   data file is always fsync-ed before it replaces the old one and the rotated journal is deleted.
+ * - Every public method takes the repository lock, so the checkpointer and the screens can share it.
+ * - Several processes share the files, so two lock files (`clsFileLock`) order them: `Clients.txt.lock`
+ *   is held by every journal append and by the snapshot + rotation of a checkpoint (an entry appended in
+ *   between would be folded away without being in the snapshot); `Clients.txt.checkpoint.lock` lets one
+ *   checkpoint or `rewriteAll()` at a time swap a new data file in. Nothing is ever appended to the data
+ *   file itself: a snapshot renamed over it by another process would silently drop the line.
+ * - Large data files are parsed in parallel by `clsLogScanner` (see `loadFile()`), and the
+ *   key index is a `clsShardedIndex` whose shards are filled in parallel too. It stores
+ *   `KeyTraits::IndexKey`s: packed `clsAccountKey` integers for clients, strings for users.
+ * - The Bloom filter file starts with the stamps (size, write time) of the data file and the journal it
+ *   was built from; when they no longer match (e.g. the program crashed before saving it) the filter
+ *   is rebuilt from the records on the next load. It is saved when rebuilt and when the program ends.
+ * - The totals file works the same way: a stamps line, then the totals. While the records are not
+ *   loaded, `getTotals()` answers from it when its stamps still match; a load recomputes the totals.
+ *   It is not saved while a batch is half built, since the in-memory totals already include it.
+ * - A "definitely not" answer is not re-validated against the disk, so a key added meanwhile by
+ *   another process is only seen once this process reloads the file for any other reason.
+ * - Appends and journal commits honour the global `DataSyncPolicy` (set from `BANK_SYNC` by `main()`):
+ *   with `SyncOnCommit` every write is flushed to the disk (`fsync` / `_commit`) before it returns, and
+ *   counted in `<name>.commitSync`.
+ * - Lookups return pointers into the cache; copy the record before keeping it past the next write.
+ * - A remove moves the last record into the removed record's place (one index entry changes), so
+ *   replaying many deletes stays linear; the records therefore keep their file order only until a remove.
+ * - A reload caused by another process keeps the changes of an open batch: they are put back on top
+ *   of the reloaded records (`app --check-repository` checks it).
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <algorithm>
+#include <filesystem>
+#include <cstdio>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include "../Core/clsGlobal.h"
+#include "../Utils/clsMetrics.h"
+#include "../Utils/clsTracer.h"
+#include "../Utils/clsBloomFilter.h"
+#include "../Utils/clsThreadPool.h"
+#include "../Utils/clsLogScanner.h"
+#include "../Utils/clsShardedIndex.h"
+#include "../Utils/clsFileLock.h"
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+using namespace std;
+
+/**
+ * @brief Compile-time serialization hooks of an entity, specialized next to each entity class.
+ */
+template <typename EntityType>
+struct clsEntityTraits;
+
+/**
+ * @brief The running totals of an entity that keeps none (`KeyTraits::Totals` of the users).
+ */
+struct stNoTotals
+{
+    static constexpr bool enabled = false;
+
+    void reset() {}
+    bool operator==(const stNoTotals &) const { return true; }
+    bool operator!=(const stNoTotals &) const { return false; }
+    void writeTo(ostream &) const {}
+    bool readFrom(istream &) { return false; }
+};
+
+/**
+ * @class clsRepository
+ * @brief A cached, key-indexed, file-backed store of entities.
+ *
+ * @tparam EntityType The stored entity (e.g. `clsBankClient`, `clsBankUser`).
+ * @tparam KeyTraits The serialization hooks of the entity, `clsEntityTraits<EntityType>` by default.
+ */
+template <typename EntityType, typename KeyTraits = clsEntityTraits<EntityType>>
+class clsRepository
+{
+private:
+    struct stFileStamp
+    {
+        bool exists = false;
+        filesystem::file_time_type writeTime;
+        uintmax_t size = 0;
+
+        bool operator==(const stFileStamp & other) const
+        {
+            return exists == other.exists && writeTime == other.writeTime && size == other.size;
+        }
+    };
+
+    static const uintmax_t _checkpointJournalBytes = 64 * 1024;
+    static constexpr chrono::seconds _checkpointInterval {30};
+    static constexpr chrono::milliseconds _checkpointRetryDelay {50};
+
+    string _fileName, _journalFileName, _rotatedJournalFileName, _filterFileName, _totalsFileName;
+    string _appendLockFileName, _checkpointLockFileName;
+
+    // built once: converting a file name into a path allocates, and every lookup checks both stamps.
+    filesystem::path _filePath, _journalFilePath;
+    bool _loaded = false;
+    size_t _generation = 0;
+    stFileStamp _stamp, _journalStamp;
+
+    recursive_mutex _lock;
+
+    // checkpointer thread state.
+    thread _checkpointer;
+    mutex _wakeLock;
+    condition_variable _wake;
+    bool _stopping = false, _checkpointRequested = false, _checkpointing = false;
+
+    vector <EntityType> _vEntities;
+    clsShardedIndex <typename KeyTraits::IndexKey> _keyIndex;
+    unordered_set <string> _dirtyKeys, _deletedKeys;
+
+    clsBloomFilter _keyFilter;
+    bool _filterReady = false, _filterDirty = false;
+
+    typename KeyTraits::Totals _totals;
+    bool _totalsDirty = false;
+
+    explicit clsRepository(const string& fileName)
+        : _fileName(fileName), _journalFileName(fileName + ".journal"), _rotatedJournalFileName(fileName + ".journal.old"),
+          _filterFileName(fileName + ".bloom"), _totalsFileName(fileName + ".totals"),
+          _appendLockFileName(fileName + ".lock"), _checkpointLockFileName(fileName + ".checkpoint.lock"),
+          _filePath(_fileName), _journalFilePath(_journalFileName)
+    {
+    }
+
+    static stFileStamp _readStamp(const filesystem::path & fileName)
+    {
+        stFileStamp stamp;
+        error_code error;
+
+        stamp.writeTime = filesystem::last_write_time(fileName, error);
+        if (error) return stamp;
+
+        stamp.size = filesystem::file_size(fileName, error);
+        stamp.exists = !error;
+        return stamp;
+    }
+
+    /**
+     * @brief Appends raw text to a file, flushing it to the disk when `DataSyncPolicy` asks for it.
+     */
+    static bool _appendToFile(const string& fileName, const string& data)
+    {
+        FILE * file = fopen(fileName.c_str(), "ab");
+        if (file == nullptr) return false;
+
+        bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+
+        if (DataSyncPolicy == enSyncPolicy::SyncOnCommit)
+        {
+            static clsMetrics::clsCounter & commitSyncs = clsMetrics::counter(string(KeyTraits::name()) + ".commitSync");
+
+            written = written && fflush(file) == 0;
+#ifdef _WIN32
+            written = written && _commit(_fileno(file)) == 0;
+#else
+            written = written && fsync(fileno(file)) == 0;
+#endif
+            commitSyncs.increment();
+        }
+
+        return fclose(file) == 0 && written;
+    }
+
+    /**
+     * @brief Writes pieces of text one after the other into a file, always flushing it to the disk.
+     */
+    static bool _writeDurably(const string& fileName, const vector <string> & vPieces)
+    {
+        FILE * file = fopen(fileName.c_str(), "wb");
+        if (file == nullptr) return false;
+
+        bool written = true;
+        for (const string & piece : vPieces)
+            written = written && fwrite(piece.data(), 1, piece.size(), file) == piece.size();
+
+        written = written && fflush(file) == 0;
+#ifdef _WIN32
+        written = written && _commit(_fileno(file)) == 0;
+#else
+        written = written && fsync(fileno(file)) == 0;
+#endif
+        return fclose(file) == 0 && written;
+    }
+
+    static string _stampToString(const stFileStamp & stamp)
+    {
+        return to_string(stamp.exists) + " " + to_string(stamp.size) + " " + to_string(stamp.writeTime.time_since_epoch().count());
+    }
+
+    string _currentStamps() const
+    {
+        return _stampToString(_readStamp(_fileName)) + " " + _stampToString(_readStamp(_journalFileName));
+    }
+
+    /**
+     * @brief Loads the persisted Bloom filter if it was built from the data file and journal as they are now.
+     */
+    void _loadFilter()
+    {
+        fstream myFile;
+        myFile.open(_filterFileName, ios::in | ios::binary);
+
+        if (!myFile.is_open()) return;
+
+        string stamps;
+        getline(myFile, stamps);
+
+        if (stamps == _currentStamps() && _keyFilter.readFrom(myFile))
+        {
+            _filterReady = true;
+            _filterDirty = false;
+        }
+        myFile.close();
+    }
+
+    void _saveFilter()
+    {
+        fstream myFile;
+        myFile.open(_filterFileName, ios::out | ios::binary);
+
+        if (myFile.is_open())
+        {
+            myFile << _currentStamps() << '\n';
+            _keyFilter.writeTo(myFile);
+            myFile.close();
+            _filterDirty = false;
+        }
+    }
+
+    /**
+     * @brief Loads the persisted totals if they were computed from the data file and journal as they are now.
+     */
+    bool _loadTotals()
+    {
+        if constexpr (!KeyTraits::Totals::enabled) return false;
+
+        fstream myFile;
+        myFile.open(_totalsFileName, ios::in);
+
+        if (!myFile.is_open()) return false;
+
+        string stamps;
+        getline(myFile, stamps);
+
+        bool loaded = stamps == _currentStamps() && _totals.readFrom(myFile);
+        myFile.close();
+        return loaded;
+    }
+
+    void _saveTotals()
+    {
+        if constexpr (!KeyTraits::Totals::enabled) return;
+
+        fstream myFile;
+        myFile.open(_totalsFileName, ios::out);
+
+        if (myFile.is_open())
+        {
+            myFile << _currentStamps() << '\n';
+            _totals.writeTo(myFile);
+            myFile.close();
+            _totalsDirty = false;
+        }
+    }
+
+    void _rebuildFilter()
+    {
+        _keyFilter.reset(_vEntities.size() * 2);
+
+        for (const EntityType & entity : _vEntities)
+            _keyFilter.add(KeyTraits::key(entity));
+
+        _filterReady = true;
+        _filterDirty = true;
+    }
+
+    void _rebuildIndex()
+    {
+        _keyIndex.build(_vEntities.size(), [this](size_t position) { return KeyTraits::indexKey(_vEntities[position]); },
+                        clsThreadPool::shared());
+    }
+
+    void _upsertInMemory(const EntityType & entity, const string& key)
+    {
+        typename KeyTraits::IndexKey indexKey = KeyTraits::indexKey(key);
+        const size_t * position = _keyIndex.find(indexKey);
+
+        _totalsDirty = true;
+
+        if (position == nullptr)
+        {
+            KeyTraits::addToTotals(_totals, entity);
+            _keyIndex.set(indexKey, _vEntities.size());
+            _vEntities.push_back(entity);
+
+            if (_filterReady)
+            {
+                _keyFilter.add(key);
+                _filterDirty = true;
+                if (_keyFilter.isOverloaded()) _rebuildFilter();
+            }
+        }
+        else
+        {
+            KeyTraits::removeFromTotals(_totals, _vEntities[*position]);
+            KeyTraits::addToTotals(_totals, entity);
+            _vEntities[*position] = entity;
+        }
+    }
+
+    /**
+     * @brief The position of the record with this key in the cache, or nullptr if there is none.
+     */
+    const size_t * _findPosition(string_view key, typename KeyTraits::IndexKey & indexKey)
+    {
+        return KeyTraits::probeKey(key, indexKey) ? _keyIndex.find(indexKey) : nullptr;
+    }
+
+    /**
+     * @brief Removes a record in O(1): the last record takes its place, so only one index entry moves.
+     */
+    bool _removeInMemory(const string& key)
+    {
+        typename KeyTraits::IndexKey indexKey;
+        const size_t * found = _findPosition(key, indexKey);
+        if (found == nullptr) return false;
+
+        size_t position = *found, last = _vEntities.size() - 1;
+
+        KeyTraits::removeFromTotals(_totals, _vEntities[position]);
+        _totalsDirty = true;
+
+        _keyIndex.erase(indexKey);
+        if (position != last)
+        {
+            _vEntities[position] = move(_vEntities[last]);
+            _keyIndex.set(KeyTraits::indexKey(_vEntities[position]), position);
+        }
+        _vEntities.pop_back();
+        return true;
+    }
+
+    /**
+     * @brief Applies the committed batches of a journal on top of the records loaded so far.
+     */
+    void _replayJournal(const string& journalFileName)
+    {
+        fstream myFile;
+        myFile.open(journalFileName, ios::in);
+
+        if (!myFile.is_open()) return;
+
+        vector <string> vBatch;
+        string line;
+
+        while (getline(myFile, line))
+        {
+            if (line == "C")
+            {
+                for (const string & entry : vBatch)
+                {
+                    if (entry[0] == 'U')
+                    {
+                        EntityType entity = KeyTraits::fromLine(entry.substr(5));
+                        _upsertInMemory(entity, KeyTraits::key(entity));
+                    }
+                    else
+                        _removeInMemory(entry.substr(5));
+                }
+                vBatch.clear();
+            }
+            else if (line.size() > 5 && (line[0] == 'U' || line[0] == 'D') && line.compare(1, 4, "#//#") == 0)
+                vBatch.push_back(line);
+        }
+        myFile.close();
+    }
+
+    void _load()
+    {
+        static clsMetrics::clsHistogram & loadLatency = clsMetrics::histogram(string(KeyTraits::name()) + ".load");
+        clsMetrics::clsScopedTimer timer(loadLatency);
+        clsTraceSpan span("clsRepository::_load");
+
+        _vEntities.clear();
+        _dirtyKeys.clear();
+        _deletedKeys.clear();
+        _generation++;
+
+        _vEntities = loadFile(_fileName, clsThreadPool::shared());
+
+        _rebuildIndex();
+
+        _totals.reset();
+        for (const EntityType & entity : _vEntities)
+            KeyTraits::addToTotals(_totals, entity);
+
+        _replayJournal(_rotatedJournalFileName);
+        _replayJournal(_journalFileName);
+        _rebuildFilter();
+
+        _stamp = _readStamp(_fileName);
+        _journalStamp = _readStamp(_journalFileName);
+        _loaded = true;
+
+        _saveFilter();
+        _saveTotals();
+    }
+
+    /**
+     * @brief Loads the file on first use, and reloads it whenever it (or its journal) was changed by someone else.
+     *
+     * The changes of an open batch are not on disk yet: they are put back on top of the reloaded
+     * records, and stay pending until the next commit.
+     */
+    void _ensureFresh()
+    {
+        if (_loaded && _readStamp(_filePath) == _stamp && _readStamp(_journalFilePath) == _journalStamp)
+            return;
+
+        if (!isDirty())
+        {
+            _load();
+            return;
+        }
+
+        vector <EntityType> vPending;
+        for (const string & key : _dirtyKeys)
+            vPending.push_back(_vEntities[*_keyIndex.find(KeyTraits::indexKey(key))]);
+
+        unordered_set <string> dirtyKeys = move(_dirtyKeys), deletedKeys = move(_deletedKeys);
+
+        _load();
+
+        for (const EntityType & entity : vPending)
+            _upsertInMemory(entity, KeyTraits::key(entity));
+
+        for (const string & key : deletedKeys)
+            _removeInMemory(key);
+
+        _dirtyKeys = move(dirtyKeys);
+        _deletedKeys = move(deletedKeys);
+    }
+
+    /**
+     * @brief Appends the dirty and deleted records to the journal as one committed batch.
+     */
+    void _appendJournal()
+    {
+        static clsMetrics::clsHistogram & appendLatency = clsMetrics::histogram(string(KeyTraits::name()) + ".journalAppend");
+        clsMetrics::clsScopedTimer timer(appendLatency);
+        clsTraceSpan span("clsRepository::_appendJournal");
+
+        string batch;
+
+        for (const string & key : _deletedKeys)
+            batch += "D#//#" + key + "\n";
+
+        for (const string & key : _dirtyKeys)
+            batch += "U#//#" + KeyTraits::toLine(_vEntities[*_keyIndex.find(KeyTraits::indexKey(key))]) + "\n";
+
+        batch += "C\n";
+
+        {
+            clsFileLock appendLock(_appendLockFileName);
+            _appendToFile(_journalFileName, batch);
+        }
+        _journalStamp = _readStamp(_journalFileName);
+
+        // the filter file records the stamps it was built from: save it again at exit.
+        _filterDirty = _filterReady;
+
+        _startCheckpointer();
+        if (_journalStamp.size >= max(_checkpointJournalBytes, _stamp.size))
+            _requestCheckpoint();
+    }
+
+    /**
+     * @brief Folds the journal into a fresh data file (temp file + atomic rename) and discards it.
+     *
+     * @param waitForLock When false (checkpointer thread) the checkpoint is skipped instead of waiting
+     *        for a foreground operation holding the lock, or while a batch is only half built.
+     * @return false if the checkpoint was skipped and should be retried.
+     */
+    bool _checkpoint(bool waitForLock)
+    {
+        static clsMetrics::clsHistogram & checkpointLatency = clsMetrics::histogram(string(KeyTraits::name()) + ".checkpoint");
+        static clsMetrics::clsCounter & checkpointsSkipped = clsMetrics::counter(string(KeyTraits::name()) + ".checkpoint.skipped");
+        clsTraceSpan span("clsRepository::_checkpoint");
+
+        // a single piece, so that it can be written by `_writeDurably()` without a copy.
+        vector <string> vSnapshot(1);
+
+        // one checkpoint at a time across the processes: a second one could rename an older snapshot
+        // over a newer one, or delete a rotated journal the first one has not folded yet.
+        optional <clsFileLock> checkpointLock;
+
+        // 1. snapshot the records and rotate the journal, under the lock.
+        {
+            unique_lock <recursive_mutex> guard(_lock, defer_lock);
+
+            if (waitForLock)
+            {
+                guard.lock();
+                if (_checkpointing) return true;
+                checkpointLock.emplace(_checkpointLockFileName);
+            }
+            else
+            {
+                checkpointLock.emplace(_checkpointLockFileName, false);
+                if (!checkpointLock->isLocked() || !guard.try_lock())
+                {
+                    checkpointsSkipped.increment();
+                    return false;
+                }
+            }
+
+            // no process may append to the journal between the snapshot and the rotation.
+            clsFileLock appendLock(_appendLockFileName);
+
+            if (waitForLock)
+                _ensureFresh();
+            else if (!_loaded || isDirty() || !(_readStamp(_filePath) == _stamp) || !(_readStamp(_journalFilePath) == _journalStamp))
+            {
+                checkpointsSkipped.increment();
+                return false;
+            }
+
+            if (_checkpointing || (!_journalStamp.exists && !filesystem::exists(_rotatedJournalFileName)))
+                return true;
+
+            for (const EntityType & entity : _vEntities)
+                vSnapshot[0] += KeyTraits::toLine(entity) + "\n";
+
+            error_code error;
+            if (!filesystem::exists(_rotatedJournalFileName))
+                filesystem::rename(_journalFileName, _rotatedJournalFileName, error);
+
+            _journalStamp = _readStamp(_journalFileName);
+            _checkpointing = true;
+        }
+
+        // 2. write the new data file, without the lock: commits keep appending to a fresh journal.
+        //    It is fsync-ed whatever the sync policy: the folded journal is deleted right after.
+        clsMetrics::clsScopedTimer timer(checkpointLatency);
+
+        string tempFileName = _fileName + ".tmp";
+        error_code error;
+
+        if (!_writeDurably(tempFileName, vSnapshot))
+            error = make_error_code(errc::io_error);
+
+        // 3. swap the new data file in and drop the folded journal, under the lock: a lookup in between
+        //    would see a data file newer than its stamp and reload everything.
+        {
+            lock_guard <recursive_mutex> guard(_lock);
+
+            if (!error)
+                filesystem::rename(tempFileName, _fileName, error);
+
+            if (!error)
+            {
+                filesystem::remove(_rotatedJournalFileName, error);
+                _stamp = _readStamp(_fileName);
+                _filterDirty = _filterReady;
+                _totalsDirty = true;
+            }
+            _checkpointing = false;
+        }
+        return true;
+    }
+
+    void _requestCheckpoint()
+    {
+        {
+            lock_guard <mutex> guard(_wakeLock);
+            _checkpointRequested = true;
+        }
+        _wake.notify_one();
+    }
+
+    /**
+     * @brief Checkpoints on request (journal size) or every `_checkpointInterval` while a journal exists.
+     */
+    void _checkpointerLoop()
+    {
+        unique_lock <mutex> guard(_wakeLock);
+
+        while (!_stopping)
+        {
+            _wake.wait_for(guard, _checkpointInterval, [this]() { return _stopping || _checkpointRequested; });
+            if (_stopping) break;
+
+            _checkpointRequested = false;
+            guard.unlock();
+
+            bool done = _checkpoint(false);
+
+            guard.lock();
+            if (!done && !_stopping)
+            {
+                // throttled: give the foreground operation time to finish, then try again.
+                _wake.wait_for(guard, _checkpointRetryDelay, [this]() { return _stopping; });
+                _checkpointRequested = true;
+            }
+        }
+    }
+
+    void _startCheckpointer()
+    {
+        if (!_checkpointer.joinable())
+            _checkpointer = thread(&clsRepository::_checkpointerLoop, this);
+    }
+
+public:
+    ~clsRepository()
+    {
+        {
+            lock_guard <mutex> guard(_wakeLock);
+            _stopping = true;
+        }
+        _wake.notify_one();
+
+        if (_checkpointer.joinable())
+            _checkpointer.join();
+
+        if (_filterDirty)
+            _saveFilter();
+
+        if (_totalsDirty && !isDirty())
+            _saveTotals();
+    }
+
+    clsRepository(const clsRepository &) = delete;
+    clsRepository & operator=(const clsRepository &) = delete;
+
+    /**
+     * @brief Returns the repository of the given data file, creating it on first use.
+     */
+    static clsRepository & open(const string& fileName)
+    {
+        // the metrics and the tracer are used by the checkpointer threads: make sure they are
+        // created first, so that they are destroyed after the repositories at exit.
+        static bool dependenciesCreated = (clsMetrics::histogram(string(KeyTraits::name()) + ".checkpoint"), clsTracer::isEnabled(), true);
+        (void)dependenciesCreated;
+
+        static map <string, unique_ptr<clsRepository>> mpRepositories;
+
+        unique_ptr<clsRepository> & repository = mpRepositories[fileName];
+        if (!repository) repository.reset(new clsRepository(fileName));
+        return *repository;
+    }
+
+    /**
+     * @brief Parses a whole data file, in parallel for large files (see `clsLogScanner`).
+     *
+     * @param endsWithNewline Optional; receives whether the file's last character is a new line.
+     */
+    static vector <EntityType> loadFile(const string& fileName, clsThreadPool & pool, bool * endsWithNewline = nullptr)
+    {
+        clsLogScanner::stScanStats stats;
+
+        vector <EntityType> vEntities = clsLogScanner::readAll<EntityType>(fileName,
+            [](const string& line) { return KeyTraits::fromLine(line); }, &stats, pool);
+
+        if (endsWithNewline != nullptr)
+            *endsWithNewline = stats.endsWithNewline;
+
+        return vEntities;
+    }
+
+    /**
+     * @brief Returns every record of the file, in file order (a removed record's place is taken by the last record).
+     */
+    const vector <EntityType> & getAll()
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        _ensureFresh();
+        return _vEntities;
+    }
+
+    /**
+     * @brief Finds a record by its unique key.
+     *
+     * @return A pointer into the cache, or nullptr if no record has this key.
+     */
+    const EntityType * find(const string& key)
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        _ensureFresh();
+
+        typename KeyTraits::IndexKey indexKey;
+        const size_t * position = _findPosition(key, indexKey);
+        return position == nullptr ? nullptr : &_vEntities[*position];
+    }
+
+    /**
+     * @brief Checks whether a record has this key, asking the Bloom filter first.
+     *
+     * A "definitely not" from the filter is returned without touching the data file;
+     * a "maybe" is confirmed against the exact key index.
+     */
+    bool exists(const string& key)
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        static clsMetrics::clsCounter & filterNegatives = clsMetrics::counter(string(KeyTraits::name()) + ".filter.negative");
+        static clsMetrics::clsCounter & filterPositives = clsMetrics::counter(string(KeyTraits::name()) + ".filter.positive");
+
+        if (!_loaded && !_filterReady)
+            _loadFilter();
+
+        if (_filterReady && !_keyFilter.mightContain(key))
+        {
+            filterNegatives.increment();
+            return false;
+        }
+
+        filterPositives.increment();
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Inserts a new record or replaces the record with the same key, and marks it dirty.
+     */
+    void upsert(const EntityType & entity)
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        _ensureFresh();
+
+        string key = KeyTraits::key(entity);
+        _upsertInMemory(entity, key);
+
+        _deletedKeys.erase(key);
+        _dirtyKeys.insert(key);
+    }
+
+    /**
+     * @brief Adds a new record by appending a single committed journal entry, without rewriting anything.
+     *
+     * The entry is replayed on top of whatever data file is current, so neither an older delete of
+     * the same key nor a checkpoint of another process renaming its snapshot over the data file can
+     * hide the new record.
+     *
+     * @return false if a record with the same key already exists.
+     */
+    bool append(const EntityType & entity)
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        static clsMetrics::clsHistogram & appendLatency = clsMetrics::histogram(string(KeyTraits::name()) + ".append");
+        clsMetrics::clsScopedTimer timer(appendLatency);
+        clsTraceSpan span("clsRepository::append");
+
+        _ensureFresh();
+
+        string key = KeyTraits::key(entity);
+        typename KeyTraits::IndexKey indexKey;
+        if (_findPosition(key, indexKey) != nullptr) return false;
+
+        _upsertInMemory(entity, key);
+
+        {
+            clsFileLock appendLock(_appendLockFileName);
+            _appendToFile(_journalFileName, "U#//#" + KeyTraits::toLine(entity) + "\nC\n");
+        }
+        _journalStamp = _readStamp(_journalFileName);
+        _filterDirty = _filterReady;
+
+        _startCheckpointer();
+        if (_journalStamp.size >= max(_checkpointJournalBytes, _stamp.size))
+            _requestCheckpoint();
+        return true;
+    }
+
+    /**
+     * @brief Removes the record with the given key, if any.
+     */
+    void remove(const string& key)
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        _ensureFresh();
+
+        if (!_removeInMemory(key)) return;
+
+        _dirtyKeys.erase(key);
+        _deletedKeys.insert(key);
+    }
+
+    /**
+     * @brief Saves one record: upserts it, or removes it when its delete sign is set.
+     */
+    void save(const EntityType & entity)
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        if (entity.getDeleteSign())
+            remove(KeyTraits::key(entity));
+        else
+            upsert(entity);
+    }
+
+    /**
+     * @brief Replaces the content of the repository with a full list of records.
+     *
+     * Only the records whose serialized form differs from the cached one are marked dirty;
+     * records with the delete sign set, or missing from the list, are removed.
+     */
+    void replaceAll(const vector <EntityType> & vEntities)
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        _ensureFresh();
+
+        unordered_set <string> keptKeys;
+
+        for (const EntityType & entity : vEntities)
+        {
+            if (entity.getDeleteSign())
+                continue;
+
+            string key = KeyTraits::key(entity);
+            keptKeys.insert(key);
+
+            const EntityType * cached = find(key);
+            if (cached == nullptr || KeyTraits::toLine(*cached) != KeyTraits::toLine(entity))
+                upsert(entity);
+        }
+
+        vector <string> vRemovedKeys;
+        for (const EntityType & entity : _vEntities)
+        {
+            string key = KeyTraits::key(entity);
+            if (keptKeys.count(key) == 0)
+                vRemovedKeys.push_back(key);
+        }
+
+        for (const string & key : vRemovedKeys)
+            remove(key);
+    }
+
+    /**
+     * @brief Counts the (re)loads of the data file, reloading it first if it changed on disk.
+     *
+     * Caches derived from the records (e.g. a name index) remember the generation they were built
+     * at: a new generation means the records were replaced wholesale and the cache must be rebuilt.
+     */
+    size_t getGeneration()
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        _ensureFresh();
+        return _generation;
+    }
+
+    /**
+     * @brief Changes every record in parallel, then persists all of them as one durable commit.
+     *
+     * The pending changes are committed and the journal is folded into the data file first; then
+     * `transformChunk(chunk, begin, end)` runs on `chunkCount` slices of the records on the shared
+     * thread pool, and the new data file is written to a temporary file, fsync-ed and renamed over
+     * the old one. A crash leaves either every change or none of them.
+     *
+     * @param transformChunk Changes the records of `[begin, end)` in place; it must not change their keys.
+     * @param chunkCount The number of slices (e.g. two per worker); `chunk` is in `[0, chunkCount)`.
+     * @return false if nothing was changed: the journal could not be folded, or the new data file could
+     *         not be written (the records are then reloaded from the untouched file on next use).
+     */
+    bool rewriteAll(const function<void(size_t chunk, EntityType * begin, EntityType * end)> & transformChunk, size_t chunkCount)
+    {
+        static clsMetrics::clsHistogram & rewriteLatency = clsMetrics::histogram(string(KeyTraits::name()) + ".rewriteAll");
+        clsMetrics::clsScopedTimer timer(rewriteLatency);
+        clsTraceSpan span("clsRepository::rewriteAll");
+
+        unique_lock <recursive_mutex> guard(_lock);
+
+        // a background checkpoint writes its snapshot without the lock, then renames it: let it finish.
+        while (_checkpointing)
+        {
+            guard.unlock();
+            this_thread::sleep_for(_checkpointRetryDelay);
+            guard.lock();
+        }
+
+        _ensureFresh();
+        commit();
+
+        // a journal left behind the new data file would replay the old records over it.
+        if (_journalStamp.exists || filesystem::exists(_rotatedJournalFileName))
+            _checkpoint(true);
+
+        // no checkpoint of another process may swap its data file in meanwhile.
+        clsFileLock checkpointLock(_checkpointLockFileName);
+
+        if (_readStamp(_journalFilePath).exists || filesystem::exists(_rotatedJournalFileName))
+            return false;
+
+        size_t count = _vEntities.size();
+        chunkCount = max<size_t>(1, min(chunkCount, count));
+
+        vector <string> vPieces(chunkCount);
+
+        clsThreadPool::shared().parallelFor(chunkCount, [&](size_t chunk)
+        {
+            EntityType * begin = _vEntities.data() + count * chunk / chunkCount;
+            EntityType * end = _vEntities.data() + count * (chunk + 1) / chunkCount;
+
+            transformChunk(chunk, begin, end);
+
+            for (EntityType * entity = begin; entity != end; ++entity)
+            {
+                vPieces[chunk] += KeyTraits::toLine(*entity);
+                vPieces[chunk] += '\n';
+            }
+        });
+
+        _totals.reset();
+        for (const EntityType & entity : _vEntities)
+            KeyTraits::addToTotals(_totals, entity);
+        _totalsDirty = true;
+
+        string tempFileName = _fileName + ".tmp";
+        error_code error;
+
+        if (_writeDurably(tempFileName, vPieces))
+            filesystem::rename(tempFileName, _fileName, error);
+        else
+            error = make_error_code(errc::io_error);
+
+        if (error)
+        {
+            _loaded = false;
+            return false;
+        }
+
+        _stamp = _readStamp(_fileName);
+        _journalStamp = _readStamp(_journalFileName);
+        _filterDirty = _filterReady;
+        return true;
+    }
+
+    /**
+     * @brief Returns the running totals of the records, in O(1).
+     *
+     * Before the records are loaded, the persisted totals are used when they are still current,
+     * so the data file is not even parsed.
+     */
+    typename KeyTraits::Totals getTotals()
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+
+        if (!_loaded && _loadTotals())
+            return _totals;
+
+        _ensureFresh();
+        return _totals;
+    }
+
+    /**
+     * @brief Computes the totals from scratch, walking every record.
+     */
+    typename KeyTraits::Totals recomputeTotals()
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+        _ensureFresh();
+
+        typename KeyTraits::Totals totals;
+        for (const EntityType & entity : _vEntities)
+            KeyTraits::addToTotals(totals, entity);
+        return totals;
+    }
+
+    /**
+     * @brief Checks the running totals against a full recompute.
+     *
+     * @param recomputed Optional; receives the recomputed totals.
+     */
+    bool verifyTotals(typename KeyTraits::Totals * recomputed = nullptr)
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+
+        typename KeyTraits::Totals totals = recomputeTotals();
+        if (recomputed != nullptr) *recomputed = totals;
+
+        return totals == _totals;
+    }
+
+    /**
+     * @brief Checks whether the repository holds changes that were not persisted yet.
+     */
+    bool isDirty() const
+    {
+        return !_deletedKeys.empty() || !_dirtyKeys.empty();
+    }
+
+    /**
+     * @brief Persists the pending changes as one journal batch; does nothing when nothing changed.
+     *
+     * Wakes the checkpointer once the journal outgrows its threshold.
+     */
+    void commit()
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+
+        if (!isDirty()) return;
+
+        _appendJournal();
+
+        _dirtyKeys.clear();
+        _deletedKeys.clear();
+    }
+
+    /**
+     * @brief Commits the pending changes and checkpoints right away, on the calling thread.
+     */
+    void compact()
+    {
+        lock_guard <recursive_mutex> guard(_lock);
+
+        commit();
+        _checkpoint(true);
+    }
+};
@@ -1,6 +1,5 @@
 #pragma once
 #include <iostream>
-#include <vector>
 #include <type_traits> // for std::is_same
 #include "../Screens/Misc/clsScreen.h"
 #include "../utils/clsUtil.h"
@@ -16,14 +15,12 @@ public:
         const string& headerTitle,
         const string& successMessage,
         string (*readUniqueKey)(enStatus),
-        EntityType & findEntityRef(const string&, vector <EntityType>&),
-        void (*printInfo)(EntityType),
+        const EntityType & (*findEntity)(const string&),
+        void (*printInfo)(const EntityType &),
         void (*changeRecord)(EntityType &),
-        void (*saveData)(const string &, const vector <EntityType> &)
+        void (*saveRecord)(const string &, const EntityType &)
     )
     {
-        vector <EntityType> vEntities = EntityType::getListVectorFromFile(fileName);
-
         _drawScreenHeader(headerTitle);
 
         string uniqueKey = readUniqueKey(enStatus::Exist);
@@ -37,7 +34,8 @@ public:
             }
         }
 
-        EntityType &entityToBeUpdated = findEntityRef(uniqueKey, vEntities);
+        // only the edited record is copied, out of the repository cache.
+        EntityType entityToBeUpdated = findEntity(uniqueKey);
 
         printInfo(entityToBeUpdated);
 
@@ -48,7 +46,7 @@ public:
             if (entityToBeUpdated.isModeUpdated())
             {
                 changeRecord(entityToBeUpdated);
-                saveData(fileName, vEntities);
+                saveRecord(fileName, entityToBeUpdated);
                 cout << successMessage;
                 printInfo(entityToBeUpdated);
             }
@@ -0,0 +1,35 @@
+#include <cstdlib>
+#include <new>
+#include "clsAllocationCheck.h"
+using namespace std;
+
+thread_local size_t clsAllocationCheck::_threadAllocations = 0;
+
+// ----- Global Allocation Functions -----
+// array and nothrow forms of `new` end up here too.
+void * operator new(size_t size)
+{
+    clsAllocationCheck::recordAllocation();
+
+    if (size == 0) size = 1;
+
+    while (true)
+    {
+        void * memory = malloc(size);
+        if (memory != nullptr) return memory;
+
+        new_handler handler = get_new_handler();
+        if (handler == nullptr) throw bad_alloc();
+        handler();
+    }
+}
+
+void operator delete(void * memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void * memory, size_t) noexcept
+{
+    free(memory);
+}
@@ -0,0 +1,90 @@
+/**
+ * @file clsAllocationCheck.h
+ * @brief Defines the `clsAllocationCheck` class, which counts the heap allocations of finding and printing a client.
+ *
+ * ## Overview
+ * Finding a client and printing its card should not copy the client or any of its fields:
+ * `clsBankClient::findClient()` returns a reference into the repository cache, and
+ * `clsPrintPersonCard::printClientInfo()` streams the fields through const references.
+ * This check proves it by counting every `operator new` made by the calling thread while one
+ * client is found and printed, after the clients file has been loaded.
+ *
+ * ## Usage
+ * ```
+ * app --check-allocs A101
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The global `operator new` / `operator delete` are replaced in `clsAllocationCheck.cpp`; the
+ *   replacements only bump a thread-local counter, so the rest of the program is unaffected and
+ *   allocations of other threads (e.g. the checkpointer) are not counted.
+ * - The first find-and-print is a warm-up that is not counted: it loads the file and lets the
+ *   console streams set up their buffers.
+ * - The exit code is 0 only when the measured find-and-print made no allocation at all.
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include "../Core/clsBankClient.h"
+#include "../Core/clsGlobal.h"
+#include "../Screens/Misc/clsPrintPersonCard.h"
+using namespace std;
+
+/**
+ * @class clsAllocationCheck
+ * @brief Counts the heap allocations made by the current thread, and checks the find-and-print path.
+ */
+class clsAllocationCheck
+{
+private:
+    static thread_local size_t _threadAllocations;
+
+    static void _findAndPrint(const string& accountNumber)
+    {
+        const clsBankClient & client = clsBankClient::findClient(accountNumber);
+
+        if (!client.isEmpty())
+            clsPrintPersonCard::printClientInfo(client);
+    }
+
+public:
+    /**
+     * @brief Called by the replaced `operator new` for every allocation.
+     */
+    static void recordAllocation()
+    {
+        _threadAllocations++;
+    }
+
+    /**
+     * @return The number of heap allocations made by the calling thread so far.
+     */
+    static size_t getThreadAllocations()
+    {
+        return _threadAllocations;
+    }
+
+    /**
+     * @brief Finds and prints one client twice, and reports the allocations of the second time.
+     *
+     * @param accountNumber The client to find.
+     * @return 0 if the measured find-and-print made no allocation, 1 otherwise (or if the client does not exist).
+     */
+    static int run(const string& accountNumber)
+    {
+        if (!clsBankClient::isClientExist(accountNumber))
+        {
+            cout << "Account Number [" << accountNumber << "] not found in " << ClientsDataFile << ".\n";
+            return 1;
+        }
+
+        _findAndPrint(accountNumber);
+
+        size_t allocationsBefore = getThreadAllocations();
+        _findAndPrint(accountNumber);
+        size_t allocations = getThreadAllocations() - allocationsBefore;
+
+        cout << "Heap allocations during find-and-print of [" << accountNumber << "]: " << allocations << "\n";
+        return allocations == 0 ? 0 : 1;
+    }
+};
@@ -0,0 +1,202 @@
+/**
+ * @file clsLoadBenchmark.h
+ * @brief Defines the `clsLoadBenchmark` class, which measures how the data file loader scales with threads.
+ *
+ * ## Overview
+ * The benchmark writes a synthetic clients file of the requested size, then loads it with the
+ * same code the repository uses at startup (`clsRepository::loadFile()` followed by a
+ * `clsShardedIndex` build) on thread pools of 1, 2, 4, 8 ... threads, up to the number of
+ * hardware threads (at least 8). For every pool size it prints the parse time, the index time,
+ * the rows parsed per second and the speed-up over one thread.
+ *
+ * It then measures what the metrics cost: the nanoseconds of one `clsHistogram::record()` and of
+ * one `clsScopedTimer` (two clock reads and a record), against `clsMetrics::sampleBudgetNanoseconds`.
+ *
+ * ## Usage
+ * ```
+ * app --bench-load 10000000
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The synthetic file is written into the system temporary folder and removed afterwards;
+ *   the real data files are never touched.
+ * - Every pool size is measured three times and the fastest run is reported, so the first run
+ *   does not pay for the OS file cache alone.
+ * - Pool sizes above the number of hardware threads are still measured, but cannot scale.
+ * - The metric costs are measured on one thread into a private histogram (uncontended), with
+ *   varying sample values so every bucket update is real; the best of three runs is kept.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include "../Core/clsBankClient.h"
+#include "../Templates/clsRepository.h"
+#include "../Utils/clsMetrics.h"
+#include "../Utils/clsThreadPool.h"
+#include "../Utils/clsShardedIndex.h"
+using namespace std;
+
+/**
+ * @class clsLoadBenchmark
+ * @brief Times the parallel loader of `clsRepository` on growing thread pools.
+ */
+class clsLoadBenchmark
+{
+private:
+    struct stRunTimes
+    {
+        double parseSeconds = 0;
+        double indexSeconds = 0;
+    };
+
+    static void _writeSyntheticFile(const string& fileName, int rows)
+    {
+        fstream myFile;
+        myFile.open(fileName, ios::out | ios::binary);
+
+        if (!myFile.is_open()) return;
+
+        string block;
+        for (int i = 0; i < rows; i++)
+        {
+            clsBankClient client(enMode::UpdateMode, "First" + to_string(i % 997), "Last" + to_string(i % 1009),
+                                 "client" + to_string(i) + "@bank.com", "0100" + to_string(1000000 + i),
+                                 to_string(1000 + i % 9000), "A" + to_string(100000000 + i), (i % 100000) / 10.0);
+
+            block += clsEntityTraits<clsBankClient>::toLine(client) + "\n";
+
+            if (block.size() > (1 << 20))
+            {
+                myFile << block;
+                block.clear();
+            }
+        }
+        myFile << block;
+        myFile.close();
+    }
+
+    static stRunTimes _timeLoad(const string& fileName, clsThreadPool & pool, size_t & rows)
+    {
+        using clock = chrono::steady_clock;
+        stRunTimes times;
+
+        clock::time_point start = clock::now();
+        vector <clsBankClient> vClients = clsRepository<clsBankClient>::loadFile(fileName, pool);
+        clock::time_point parsed = clock::now();
+
+        clsShardedIndex <clsAccountKey> index;
+        index.build(vClients.size(), [&vClients](size_t position) { return vClients[position].getAccountKey(); }, pool);
+        clock::time_point indexed = clock::now();
+
+        times.parseSeconds = chrono::duration<double>(parsed - start).count();
+        times.indexSeconds = chrono::duration<double>(indexed - parsed).count();
+        rows = vClients.size();
+        return times;
+    }
+
+    /**
+     * @brief The best of three runs of `samples` calls of `sample(i)`, in nanoseconds per call.
+     */
+    template <typename Sampler>
+    static double _nanosecondsPerSample(int samples, Sampler sample)
+    {
+        using clock = chrono::steady_clock;
+        double best = 0;
+
+        for (int run = 0; run < 3; run++)
+        {
+            clock::time_point start = clock::now();
+            for (int i = 0; i < samples; i++)
+                sample(i);
+            double nanoseconds = chrono::duration<double, nano>(clock::now() - start).count() / samples;
+
+            if (run == 0 || nanoseconds < best) best = nanoseconds;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Prints the cost of one histogram sample and of one scoped timer.
+     * @return false if a histogram sample costs more than `clsMetrics::sampleBudgetNanoseconds`.
+     */
+    static bool _reportMetricsCost()
+    {
+        const int samples = 10000000;
+        static clsMetrics::clsHistogram histogram;
+
+        double recordNanoseconds = _nanosecondsPerSample(samples, [](int i) { histogram.record(uint64_t(i & 4095) * 37); });
+        double timerNanoseconds = _nanosecondsPerSample(samples, [](int) { clsMetrics::clsScopedTimer timer(histogram); });
+
+        bool withinBudget = recordNanoseconds <= clsMetrics::sampleBudgetNanoseconds;
+
+        cout << defaultfloat << "\nMetrics cost (" << samples << " samples, budget " << clsMetrics::sampleBudgetNanoseconds << " ns per sample):\n";
+        cout << fixed << setprecision(1);
+        cout << "  clsHistogram::record() : " << recordNanoseconds << " ns" << (withinBudget ? "" : "  [over budget]") << "\n";
+        cout << "  clsScopedTimer         : " << timerNanoseconds << " ns (two clock reads and a record)\n";
+        cout << defaultfloat;
+
+        return withinBudget;
+    }
+
+public:
+    /**
+     * @brief Runs the benchmark and prints the scaling table.
+     *
+     * @param rows Number of synthetic client records to load.
+     * @return 0 on success, 1 if the synthetic file could not be loaded or a metric sample is over its budget.
+     */
+    static int run(int rows)
+    {
+        string fileName = (filesystem::temp_directory_path() / "bank_load_benchmark.txt").string();
+
+        cout << "Writing " << rows << " synthetic clients into " << fileName << " ...\n";
+        _writeSyntheticFile(fileName, rows);
+
+        size_t maxThreads = max<size_t>(8, thread::hardware_concurrency());
+        double baseSeconds = 0;
+        int result = 0;
+
+        cout << "\n" << setw(10) << left << "Threads:" << setw(12) << "Parse s:" << setw(12) << "Index s:"
+             << setw(12) << "Total s:" << setw(16) << "Rows/s:" << "Speed-up:\n";
+        cout << string(70, '-') << "\n";
+
+        for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            clsThreadPool pool(threads);
+            stRunTimes best;
+            size_t loadedRows = 0;
+
+            for (int run = 0; run < 3; run++)
+            {
+                stRunTimes times = _timeLoad(fileName, pool, loadedRows);
+
+                if (run == 0 || times.parseSeconds + times.indexSeconds < best.parseSeconds + best.indexSeconds)
+                    best = times;
+            }
+
+            if (loadedRows != size_t(rows)) result = 1;
+
+            double totalSeconds = best.parseSeconds + best.indexSeconds;
+            if (threads == 1) baseSeconds = totalSeconds;
+
+            cout << setw(10) << left << threads << fixed << setprecision(3) << setw(12) << best.parseSeconds
+                 << setw(12) << best.indexSeconds << setw(12) << totalSeconds << setprecision(0)
+                 << setw(16) << loadedRows / totalSeconds << setprecision(2) << baseSeconds / totalSeconds << "x\n";
+        }
+
+        cout << "\nHardware threads: " << thread::hardware_concurrency() << "\n";
+
+        if (!_reportMetricsCost()) result = 1;
+
+        error_code error;
+        filesystem::remove(fileName, error);
+        return result;
+    }
+};
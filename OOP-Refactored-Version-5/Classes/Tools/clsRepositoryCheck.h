@@ -0,0 +1,287 @@
+/**
+ * @file clsRepositoryCheck.h
+ * @brief Defines the `clsRepositoryCheck` class, which checks what the repository persists across reloads, outside changes and sync policies.
+ *
+ * ## Overview
+ * A batch (e.g. the debit and the credit of a transfer) is built with several `upsert()` /
+ * `remove()` calls and persisted by one `commit()`. Every call first checks the stamps of the data
+ * file and of its journal, and reloads the records when someone else changed them. This check
+ * opens a batch on a scratch clients file, commits a change to the same file from "another
+ * process" in the middle of the batch, finishes the batch and commits it, then reads the file back
+ * and verifies that both the batch and the outside change were kept.
+ *
+ * ## Usage
+ * ```
+ * app --check-repository
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The scratch file (and its journal, filter and totals files) lives in the system temporary
+ *   folder and is removed afterwards; the real data files are never touched.
+ * - The outside change is a committed batch appended to the journal by hand, exactly as another
+ *   instance of the program would write it.
+ * - A second part removes every other record of a larger scratch file and finds every key again:
+ *   a remove moves the last record into the freed place, so the index entries must follow it.
+ * - A third part adds a record, then swaps in a data file that lacks it, as a checkpoint of another
+ *   process renaming an older snapshot would; the add must survive, since it only lives in the journal.
+ * - A fourth part looks up account numbers that do not pack into a `clsAccountKey`: a stored one
+ *   must be found, and the ones only asked about must not be left in the process-wide intern table.
+ * - A last part commits under both `DataSyncPolicy` values and counts the writes flushed to the disk
+ *   (`client.commitSync`), whatever `BANK_SYNC` the check was started with.
+ * - The exit code is 0 only when every expected balance (and delete) is found on disk.
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <filesystem>
+#include "../Core/clsBankClient.h"
+#include "../Templates/clsRepository.h"
+#include "../Utils/clsThreadPool.h"
+#include "../Utils/clsMetrics.h"
+#include "../Core/clsGlobal.h"
+using namespace std;
+
+/**
+ * @class clsRepositoryCheck
+ * @brief Runs a batch across an outside change of the data file and checks what reached the disk.
+ */
+class clsRepositoryCheck
+{
+private:
+    static clsBankClient _client(int number, float balance)
+    {
+        return clsBankClient(enMode::UpdateMode, "First" + to_string(number), "Last" + to_string(number),
+                             "client" + to_string(number) + "@bank.com", "0100" + to_string(1000 + number),
+                             "1234", "C" + to_string(number), balance);
+    }
+
+    static void _writeFile(const string& fileName, const string& data)
+    {
+        fstream myFile;
+        myFile.open(fileName, ios::out | ios::app | ios::binary);
+
+        if (myFile.is_open())
+        {
+            myFile << data;
+            myFile.close();
+        }
+    }
+
+    static void _removeFiles(const string& fileName)
+    {
+        error_code error;
+
+        for (const char * suffix : { "", ".journal", ".journal.old", ".bloom", ".totals", ".tmp", ".lock", ".checkpoint.lock" })
+            filesystem::remove(fileName + suffix, error);
+    }
+
+    static bool _expect(const string& what, bool passed)
+    {
+        cout << (passed ? "  [ OK ] " : "  [FAIL] ") << what << "\n";
+        return passed;
+    }
+
+    /**
+     * @brief Removes every other record of a scratch file, then finds each record left and each one removed.
+     */
+    static bool _checkRemoves(const string& fileName)
+    {
+        const int count = 1000;
+
+        string data;
+        for (int number = 1; number <= count; number++)
+            data += clsEntityTraits<clsBankClient>::toLine(_client(number, float(number))) + "\n";
+        _writeFile(fileName, data);
+
+        clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(fileName);
+
+        for (int number = 1; number <= count; number += 2)
+            repository.remove("C" + to_string(number));
+        repository.commit();
+
+        bool indexed = repository.getAll().size() == size_t(count / 2);
+        for (int number = 1; number <= count; number++)
+        {
+            const clsBankClient * client = repository.find("C" + to_string(number));
+
+            if (number % 2 == 1)
+                indexed &= client == nullptr;
+            else
+                indexed &= client != nullptr && client->getAccountBalance() == float(number);
+        }
+
+        repository.compact();
+
+        bool written = true;
+        vector <clsBankClient> vClients = clsRepository<clsBankClient>::loadFile(fileName, clsThreadPool::shared());
+        for (const clsBankClient & client : vClients)
+            written &= int(client.getAccountBalance()) % 2 == 0;
+
+        cout << "Removes of " << count / 2 << " out of " << count << " records:\n";
+        bool passed = _expect("every record left is found at its new place, every removed one is gone", indexed);
+        passed &= _expect("the data file holds exactly the records left", written && vClients.size() == size_t(count / 2));
+
+        _removeFiles(fileName);
+        return passed;
+    }
+
+    /**
+     * @brief Looks up a stored account number that does not pack, and several that are only probed.
+     */
+    static bool _checkProbesNotInterned(const string& fileName)
+    {
+        clsBankClient stored(enMode::UpdateMode, "First", "Last", "client@bank.com", "01001000", "1234", "c-stored", 100);
+        _writeFile(fileName, clsEntityTraits<clsBankClient>::toLine(stored) + "\n");
+
+        clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(fileName);
+
+        repository.remove("c-probe-3");
+        repository.commit();
+
+        bool found = repository.find("c-stored") != nullptr;
+        bool missed = repository.find("c-probe-1") == nullptr && !repository.exists("c-probe-2");
+
+        clsAccountKey key;
+        bool interned = clsAccountKey::findExisting("c-stored", key);
+        bool probesLeft = clsAccountKey::findExisting("c-probe-1", key) || clsAccountKey::findExisting("c-probe-2", key) ||
+                          clsAccountKey::findExisting("c-probe-3", key);
+
+        cout << "Lookups of account numbers that do not pack:\n";
+        bool passed = _expect("the stored one is found, the probed ones are not", found && missed);
+        passed &= _expect("only the stored one is interned", interned && !probesLeft);
+
+        _removeFiles(fileName);
+        return passed;
+    }
+
+    /**
+     * @brief Adds a record, then renames a snapshot taken before the add over the data file, as the
+     *        checkpoint of another process would, and looks for the record again.
+     */
+    static bool _checkAppendAcrossRename(const string& fileName)
+    {
+        string data;
+        for (int number = 1; number <= 2; number++)
+            data += clsEntityTraits<clsBankClient>::toLine(_client(number, 100)) + "\n";
+        _writeFile(fileName, data);
+
+        clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(fileName);
+        bool appended = repository.append(_client(5, 500));
+
+        // the other process's snapshot does not know C5 yet.
+        _writeFile(fileName + ".tmp", data);
+        error_code error;
+        filesystem::rename(fileName + ".tmp", fileName, error);
+
+        const clsBankClient * client = repository.find("C5");
+        bool found = appended && !error && client != nullptr && client->getAccountBalance() == 500;
+
+        repository.compact();
+
+        bool written = false;
+        for (const clsBankClient & stored : clsRepository<clsBankClient>::loadFile(fileName, clsThreadPool::shared()))
+            written |= stored.getAccountNumber().str() == "C5";
+
+        cout << "Add across a data file swapped in by another process:\n";
+        bool passed = _expect("C5 added before the swap is found after it", found);
+        passed &= _expect("C5 is in the data file after the next checkpoint", written);
+
+        _removeFiles(fileName);
+        return passed;
+    }
+
+    /**
+     * @brief Adds and commits under each sync policy, and counts the writes flushed to the disk.
+     */
+    static bool _checkSyncPolicy(const string& fileName)
+    {
+        _writeFile(fileName, clsEntityTraits<clsBankClient>::toLine(_client(1, 100)) + "\n");
+
+        clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(fileName);
+        clsMetrics::clsCounter & commitSyncs = clsMetrics::counter("client.commitSync");
+        enSyncPolicy oldPolicy = DataSyncPolicy;
+
+        DataSyncPolicy = enSyncPolicy::NoSync;
+        uint64_t before = commitSyncs.getValue();
+        repository.append(_client(2, 200));
+        repository.upsert(_client(1, 150));
+        repository.commit();
+        bool notSynced = commitSyncs.getValue() == before;
+
+        DataSyncPolicy = enSyncPolicy::SyncOnCommit;
+        before = commitSyncs.getValue();
+        repository.append(_client(3, 300));
+        repository.upsert(_client(1, 175));
+        repository.commit();
+        bool synced = commitSyncs.getValue() == before + 2;
+
+        DataSyncPolicy = oldPolicy;
+        repository.compact();
+
+        map <string, float> mpBalances;
+        for (const clsBankClient & client : clsRepository<clsBankClient>::loadFile(fileName, clsThreadPool::shared()))
+            mpBalances[client.getAccountNumber().str()] = client.getAccountBalance();
+
+        cout << "Sync policy (BANK_SYNC):\n";
+        bool passed = _expect("NoSync leaves the add and the commit to the OS cache", notSynced);
+        passed &= _expect("SyncOnCommit flushes the add and the commit to the disk", synced);
+        passed &= _expect("the records written under both policies are on disk",
+                          mpBalances.size() == 3 && mpBalances["C1"] == 175 && mpBalances["C2"] == 200 && mpBalances["C3"] == 300);
+
+        _removeFiles(fileName);
+        return passed;
+    }
+
+public:
+    /**
+     * @brief Runs the check and prints one line per expectation.
+     *
+     * @return 0 if every expectation holds, 1 otherwise.
+     */
+    static int run()
+    {
+        string fileName = (filesystem::temp_directory_path() / "bank_repository_check.txt").string();
+        _removeFiles(fileName);
+
+        string data;
+        for (int number = 1; number <= 4; number++)
+            data += clsEntityTraits<clsBankClient>::toLine(_client(number, 100)) + "\n";
+        _writeFile(fileName, data);
+
+        clsRepository<clsBankClient> & repository = clsRepository<clsBankClient>::open(fileName);
+        repository.getAll();
+
+        // the batch: a transfer of 50 from C1 to C2, and the delete of C4.
+        repository.upsert(_client(1, 50));
+        repository.remove("C4");
+
+        // another process commits a change of C3 in the middle of the batch.
+        _writeFile(fileName + ".journal", "U#//#" + clsEntityTraits<clsBankClient>::toLine(_client(3, 300)) + "\nC\n");
+
+        repository.upsert(_client(2, 150));
+        repository.commit();
+        repository.compact();
+
+        map <string, float> mpBalances;
+        for (const clsBankClient & client : clsRepository<clsBankClient>::loadFile(fileName, clsThreadPool::shared()))
+            mpBalances[client.getAccountNumber().str()] = client.getAccountBalance();
+
+        bool passed = true;
+        cout << "Batch across an outside change of " << fileName << ":\n";
+        passed &= _expect("C1 debited before the change is kept", mpBalances.count("C1") && mpBalances["C1"] == 50);
+        passed &= _expect("C2 credited after the change is kept", mpBalances.count("C2") && mpBalances["C2"] == 150);
+        passed &= _expect("C3 changed by the other process is kept", mpBalances.count("C3") && mpBalances["C3"] == 300);
+        passed &= _expect("C4 deleted before the change stays deleted", mpBalances.count("C4") == 0);
+
+        _removeFiles(fileName);
+
+        passed &= _checkRemoves(fileName);
+        passed &= _checkAppendAcrossRename(fileName);
+        passed &= _checkProbesNotInterned(fileName);
+        passed &= _checkSyncPolicy(fileName);
+        return passed ? 0 : 1;
+    }
+};
@@ -0,0 +1,370 @@
+/**
+ * @file clsSessionReplayer.h
+ * @brief Defines the `clsSessionReplayer` class, a scripted end-to-end load tester for the teller screens.
+ *
+ * ## Overview
+ * The `clsSessionReplayer` replays recorded keystroke scripts (login, deposit, transfer, list ...)
+ * through the real screens, starting from `clsLoginScreen::showLogInScreen()`, exactly as a teller
+ * would type them. Sessions run side by side on worker threads; each worker drives its session in a
+ * child process of the program (`app --replay-session <script>`) whose console is a pipe, so every
+ * session has its own `cin`, `cout` and `currentUser`, and the sessions share the data files the way
+ * several teller terminals do.
+ * Every session is checked against the output its script expects, timed as one operation, and a
+ * report of per-operation latency percentiles, failures and the overall throughput is printed at the end.
+ *
+ * ## Script Format
+ * A script is a plain text file holding the keystrokes of one session, one answer per line.
+ * Lines starting with `#expect ` are not keystrokes: each holds a text the session output must
+ * contain (e.g. `#expect Transfer Done Successfully.`).
+ * The operation name reported for a script is its file name without the extension
+ * (e.g. `Replay Scripts/deposit.txt` → `deposit`).
+ * A session ends normally either when the screens return or when the script runs out of keystrokes.
+ *
+ * ## Usage
+ * ```
+ * app --replay "Replay Scripts" 500 8
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The screens read and write the process-wide `cin` / `cout` and `currentUser`, which cannot be
+ *   given to one thread only: that is why a session runs in its own process, driven by its thread.
+ * - A session fails when its process does not report a clean end (an exception other than running
+ *   out of keystrokes, or a crash), or when an expected text is missing from its output.
+ * - The latency of a session is measured inside its process, from login to its end, so it does not
+ *   include starting the process; the throughput is measured on the wall clock across all workers.
+ * - Scripts mutate the data files the same way a teller would (deposits, transfers ...),
+ *   so replay against a copy of `Database Text Files` when the data matters.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <cstdio>
+#include "../Utils/clsConsoleRedirect.h"
+#include "../Core/clsGlobal.h"
+#include "../Core/clsBankUser.h"
+#include "../Screens/Login/clsLoginScreen.h"
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+using namespace std;
+
+/**
+ * @class clsSessionReplayer
+ * @brief Replays keystroke scripts through the screens and reports latency percentiles and throughput.
+ */
+class clsSessionReplayer
+{
+private:
+    struct stScript
+    {
+        string operation;
+        string fileName;
+        string keystrokes;
+        vector <string> vExpected;
+    };
+
+    struct stSessionResult
+    {
+        double milliseconds = 0;
+        bool failed = false;
+        string reason;
+    };
+
+    struct stOperationStats
+    {
+        vector <double> vLatencies; // milliseconds, one per session
+        int failedSessions = 0;
+    };
+
+    static const size_t _shownFailures = 5;
+
+    // the last line a session process prints: "#replay-session <ms> ok" or "#replay-session <ms> failed <reason>".
+    static string _sessionReportTag()
+    {
+        return "#replay-session ";
+    }
+
+    static string _expectTag()
+    {
+        return "#expect ";
+    }
+
+    /**
+     * @brief Reads a script file, splitting its keystrokes from its `#expect` lines.
+     */
+    static stScript _loadScript(const filesystem::path & path)
+    {
+        stScript script {path.stem().string(), path.string(), "", {}};
+
+        fstream myFile(path, ios::in);
+        string line;
+
+        while (getline(myFile, line))
+        {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+
+            if (line.compare(0, _expectTag().size(), _expectTag()) == 0)
+                script.vExpected.push_back(line.substr(_expectTag().size()));
+            else
+                script.keystrokes += line + "\n";
+        }
+        return script;
+    }
+
+    /**
+     * @brief Loads every `.txt` script found in the given folder, sorted by file name.
+     */
+    static vector <stScript> _loadScripts(const string& folderName)
+    {
+        vector <stScript> vScripts;
+
+        if (!filesystem::is_directory(folderName))
+            return vScripts;
+
+        for (const filesystem::directory_entry & entry : filesystem::directory_iterator(folderName))
+        {
+            if (!entry.is_regular_file() || entry.path().extension() != ".txt")
+                continue;
+
+            vScripts.push_back(_loadScript(entry.path()));
+        }
+
+        sort(vScripts.begin(), vScripts.end(), [](const stScript & a, const stScript & b) { return a.operation < b.operation; });
+        return vScripts;
+    }
+
+    /**
+     * @brief Runs one session in a child process and checks its output.
+     *
+     * @param executable The path of this program.
+     */
+    static stSessionResult _runSession(const string& executable, const stScript & script)
+    {
+        stSessionResult result;
+
+        string command = "\"" + executable + "\" --replay-session \"" + script.fileName + "\"";
+#ifdef _WIN32
+        // cmd.exe strips the outer quotes of a command line that starts with one.
+        command = "\"" + command + "\"";
+#endif
+
+        FILE * pipe = popen(command.c_str(), "r");
+        if (pipe == nullptr)
+        {
+            result.failed = true;
+            result.reason = "could not start [" + command + "]";
+            return result;
+        }
+
+        string output;
+        char buffer[64 * 1024];
+        size_t readBytes;
+
+        while ((readBytes = fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+            output.append(buffer, readBytes);
+
+        int status = pclose(pipe);
+
+        size_t report = output.rfind(_sessionReportTag());
+        if (report == string::npos)
+        {
+            result.failed = true;
+            result.reason = "ended without a report (exit status " + to_string(status) + ")";
+            return result;
+        }
+
+        istringstream reportLine(output.substr(report + _sessionReportTag().size()));
+        string outcome;
+        reportLine >> result.milliseconds >> outcome;
+
+        if (outcome != "ok" || status != 0)
+        {
+            result.failed = true;
+            getline(reportLine >> ws, result.reason);
+            if (result.reason.empty()) result.reason = "exit status " + to_string(status);
+            return result;
+        }
+
+        for (const string & expected : script.vExpected)
+        {
+            if (output.find(expected) == string::npos)
+            {
+                result.failed = true;
+                result.reason = "expected [" + expected + "] in the output";
+                break;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the nearest-rank percentile of an ascending sorted vector.
+     */
+    static double _percentile(const vector <double> & vSorted, double percent)
+    {
+        if (vSorted.empty()) return 0;
+
+        size_t rank = (size_t)((percent / 100.0) * vSorted.size() + 0.5);
+        rank = clamp(rank, (size_t)1, vSorted.size());
+        return vSorted[rank - 1];
+    }
+
+    static void _printReport(map <string, stOperationStats> & mpStats, int totalSessions, int workers, double totalSeconds)
+    {
+        cout << "\n\t\t\t\tReplay Report (" << totalSessions << " sessions on " << workers << " workers in "
+             << fixed << setprecision(2) << totalSeconds << " s)\n";
+        cout << "------------------------------------------------------------------------------------------\n";
+        cout << "| " << left << setw(14) << "Operation:";
+        cout << "| " << left << setw(9) << "Count:";
+        cout << "| " << left << setw(8) << "Failed:";
+        cout << "| " << left << setw(10) << "p50 ms:";
+        cout << "| " << left << setw(10) << "p90 ms:";
+        cout << "| " << left << setw(10) << "p99 ms:";
+        cout << "| " << left << setw(10) << "max ms:" << "|\n";
+        cout << "------------------------------------------------------------------------------------------\n";
+
+        for (auto & [operation, stats] : mpStats)
+        {
+            sort(stats.vLatencies.begin(), stats.vLatencies.end());
+
+            cout << "| " << left << setw(14) << operation;
+            cout << "| " << left << setw(9) << stats.vLatencies.size();
+            cout << "| " << left << setw(8) << stats.failedSessions;
+            cout << "| " << left << setw(10) << _percentile(stats.vLatencies, 50);
+            cout << "| " << left << setw(10) << _percentile(stats.vLatencies, 90);
+            cout << "| " << left << setw(10) << _percentile(stats.vLatencies, 99);
+            cout << "| " << left << setw(10) << (stats.vLatencies.empty() ? 0 : stats.vLatencies.back()) << "|\n";
+        }
+
+        cout << "------------------------------------------------------------------------------------------\n";
+        cout << "Throughput: " << (totalSeconds > 0 ? totalSessions / totalSeconds : 0) << " sessions/s\n" << defaultfloat;
+    }
+
+public:
+    /**
+     * @brief Runs one scripted session on this process's console, then prints its report line.
+     *
+     * This is the child side of `replay()` (`app --replay-session <script>`): the screens output goes
+     * to the standard output, followed by `#replay-session <ms> ok` or `#replay-session <ms> failed <reason>`.
+     *
+     * @param scriptFileName The script to replay.
+     * @return 0 if the session ended cleanly, 1 otherwise.
+     */
+    static int replaySession(const string& scriptFileName)
+    {
+        stScript script = _loadScript(scriptFileName);
+        istringstream input(script.keystrokes);
+        string error;
+
+        auto start = chrono::steady_clock::now();
+        {
+            clsConsoleRedirect redirect(input.rdbuf(), cout.rdbuf());
+
+            try
+            {
+                clsLoginScreen::showLogInScreen();
+            }
+            catch (const ios_base::failure &)
+            {
+                // the recorded keystrokes ran out: the session is over.
+            }
+            catch (const exception & e)
+            {
+                error = e.what();
+                if (error.empty()) error = "exception";
+            }
+            catch (...)
+            {
+                error = "unknown exception";
+            }
+        }
+        auto end = chrono::steady_clock::now();
+
+        cout << "\n" << _sessionReportTag() << chrono::duration<double, milli>(end - start).count()
+             << (error.empty() ? " ok" : " failed " + error) << endl;
+        return error.empty() ? 0 : 1;
+    }
+
+    /**
+     * @brief Replays the scripts of a folder round-robin for the given number of sessions, on worker threads.
+     *
+     * @param executable The path of this program, started once per session.
+     * @param folderName The folder containing the `.txt` keystroke scripts.
+     * @param sessions The total number of sessions to replay.
+     * @param workers The number of sessions running at the same time.
+     * @return 0 if every session passed, 1 if a session failed or no script could be loaded.
+     */
+    static int replay(const string& executable, const string& folderName, int sessions, int workers)
+    {
+        vector <stScript> vScripts = _loadScripts(folderName);
+
+        if (vScripts.empty())
+        {
+            cout << "No replay scripts found in [" << folderName << "]." << endl;
+            return 1;
+        }
+
+        workers = max(1, min(workers, sessions));
+
+        map <string, stOperationStats> mpStats;
+        vector <string> vFailures;
+        int failedSessions = 0;
+        mutex statsLock;
+        atomic <int> nextSession(0);
+
+        auto start = chrono::steady_clock::now();
+
+        vector <thread> vWorkers;
+        for (int worker = 0; worker < workers; worker++)
+        {
+            vWorkers.emplace_back([&]()
+            {
+                for (int i = nextSession++; i < sessions; i = nextSession++)
+                {
+                    const stScript & script = vScripts[i % vScripts.size()];
+                    stSessionResult result = _runSession(executable, script);
+
+                    lock_guard <mutex> guard(statsLock);
+                    stOperationStats & stats = mpStats[script.operation];
+                    stats.vLatencies.push_back(result.milliseconds);
+
+                    if (result.failed)
+                    {
+                        stats.failedSessions++;
+                        failedSessions++;
+                        if (vFailures.size() < _shownFailures)
+                            vFailures.push_back("session " + to_string(i + 1) + " (" + script.operation + "): " + result.reason);
+                    }
+                }
+            });
+        }
+
+        for (thread & worker : vWorkers)
+            worker.join();
+
+        auto end = chrono::steady_clock::now();
+
+        _printReport(mpStats, sessions, workers, chrono::duration<double>(end - start).count());
+
+        if (failedSessions > 0)
+        {
+            cout << "\n" << failedSessions << " session(s) failed";
+            cout << (size_t(failedSessions) > vFailures.size() ? ", first ones:\n" : ":\n");
+            for (const string & failure : vFailures)
+                cout << "  " << failure << "\n";
+        }
+        return failedSessions > 0 ? 1 : 0;
+    }
+};
@@ -0,0 +1,150 @@
+/**
+ * @file clsSortBenchmark.h
+ * @brief Defines the `clsSortBenchmark` class, which measures the external sort of the transfer log.
+ *
+ * ## Overview
+ * The benchmark writes a synthetic transfer log of the requested size, then sorts it on disk with
+ * `clsTransferRecord::sortTransferRecords()` by every `enTransferSortKey` in turn. For every key it
+ * prints the number of runs and merge passes, the time of the run and merge phases, the throughput,
+ * and whether the output was verified (sorted, with every record of the log).
+ *
+ * ## Usage
+ * ```
+ * app --bench-sort 51200 256 /mnt/scratch     (a 50 GB log, a 256 MB budget, written under /mnt/scratch)
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The log, the sorted output and the run files live in the given folder (the system temporary
+ *   folder by default) and are removed afterwards; the real data files are never touched.
+ * - The synthetic records follow the real log format: 1,000,000 accounts, timestamps spread over
+ *   two years and amounts from 1 to 10,000, from a fixed-seed generator.
+ * - The sort needs about twice the log size of free disk space (runs plus output).
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <filesystem>
+#include <cstdint>
+#include "../Screens/Transactions/clsTransferRecord.h"
+#include "../Utils/clsExternalSorter.h"
+using namespace std;
+
+/**
+ * @class clsSortBenchmark
+ * @brief Times the external sort of a synthetic transfer log by every sort key.
+ */
+class clsSortBenchmark
+{
+private:
+    static uint64_t _writeSyntheticLog(const string& fileName, uint64_t bytes)
+    {
+        fstream myFile;
+        myFile.open(fileName, ios::out | ios::binary);
+
+        if (!myFile.is_open()) return 0;
+
+        uint64_t state = 0x2545F4914F6CDD1DULL, records = 0, written = 0;
+        auto nextRandom = [&state]()
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        };
+
+        string block;
+        while (written < bytes)
+        {
+            uint64_t random = nextRandom();
+
+            block += to_string(1 + random % 28) + "/" + to_string(1 + (random >> 5) % 12) + "/" + to_string(2025 + (random >> 9) % 2);
+            block += " - " + to_string((random >> 10) % 24) + ":" + to_string((random >> 15) % 60) + ":" + to_string((random >> 21) % 60);
+            block += "#//#A" + to_string(100000 + (random >> 27) % 1000000);
+            block += "#//#A" + to_string(100000 + nextRandom() % 1000000);
+            block += "#//#" + to_string(1 + (random >> 47) % 10000) + ".000000";
+            block += "#//#" + to_string((random >> 3) % 1000000) + ".000000";
+            block += "#//#" + to_string((random >> 13) % 1000000) + ".000000#//#admin\n";
+            records++;
+
+            if (block.size() > (1 << 20))
+            {
+                myFile << block;
+                written += block.size();
+                block.clear();
+            }
+        }
+        myFile << block;
+        myFile.close();
+
+        return records;
+    }
+
+    static string _keyName(enTransferSortKey sortKey)
+    {
+        switch (sortKey)
+        {
+        case enTransferSortKey::SourceAccount: return "Source";
+        case enTransferSortKey::DestinationAccount: return "Destination";
+        case enTransferSortKey::Timestamp: return "Timestamp";
+        case enTransferSortKey::Amount: return "Amount";
+        }
+        return "";
+    }
+
+public:
+    /**
+     * @brief Runs the benchmark and prints one line per sort key.
+     *
+     * @param megabytes The size of the synthetic log.
+     * @param budgetMegabytes The memory budget of the sort.
+     * @param folder The folder holding the log, the runs and the output (the temporary folder when empty).
+     * @return 0 on success, 1 if a sort failed or an output did not verify.
+     */
+    static int run(uint64_t megabytes, size_t budgetMegabytes, string folder = "")
+    {
+        if (folder.empty()) folder = filesystem::temp_directory_path().string();
+
+        string logFile = folder + "/bank_sort_benchmark.txt";
+        string sortedFile = folder + "/bank_sort_benchmark.sorted.txt";
+        int result = 0;
+
+        cout << "Writing a " << megabytes << " MB synthetic transfer log into " << logFile << " ...\n";
+        uint64_t records = _writeSyntheticLog(logFile, megabytes * 1024 * 1024);
+
+        cout << records << " records, sorted with a " << budgetMegabytes << " MB budget on "
+             << clsThreadPool::shared().getThreadCount() << " thread(s).\n";
+
+        cout << "\n" << setw(14) << left << "Key:" << setw(8) << "Runs:" << setw(9) << "Passes:" << setw(10) << "Runs s:"
+             << setw(11) << "Merge s:" << setw(11) << "Total s:" << setw(9) << "MB/s:" << "Verified:\n";
+        cout << string(80, '-') << "\n";
+
+        for (enTransferSortKey sortKey : {enTransferSortKey::SourceAccount, enTransferSortKey::DestinationAccount,
+                                          enTransferSortKey::Timestamp, enTransferSortKey::Amount})
+        {
+            stExternalSortStats stats;
+            bool sorted = clsTransferRecord::sortTransferRecords(logFile, sortedFile, sortKey, budgetMegabytes * 1024 * 1024, &stats);
+
+            uint64_t sortedRecords = 0;
+            bool verified = sorted && clsTransferRecord::isTransferRecordFileSorted(sortedFile, sortKey, &sortedRecords)
+                            && sortedRecords == records;
+            if (!verified) result = 1;
+
+            double totalSeconds = stats.runSeconds + stats.mergeSeconds;
+
+            cout << setw(14) << left << _keyName(sortKey) << setw(8) << stats.runs << setw(9) << stats.mergePasses
+                 << fixed << setprecision(2) << setw(10) << stats.runSeconds << setw(11) << stats.mergeSeconds
+                 << setw(11) << totalSeconds << setprecision(0) << setw(9) << (totalSeconds > 0 ? stats.bytes / 1048576.0 / totalSeconds : 0)
+                 << (verified ? "yes" : "NO") << "\n";
+            cout << defaultfloat;
+        }
+
+        error_code error;
+        filesystem::remove(logFile, error);
+        filesystem::remove(sortedFile, error);
+        return result;
+    }
+};
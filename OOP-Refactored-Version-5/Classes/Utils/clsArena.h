@@ -0,0 +1,191 @@
+/**
+ * @file clsArena.h
+ * @brief Declares the `clsArena` monotonic allocator and the `clsArenaAllocator` / `clsArenaVector` adapters.
+ *
+ * ## Overview
+ * A list screen loads every record, prints it, and throws everything away. With `std::string`
+ * fields that is several heap allocations per record on the way in and as many frees on the way
+ * out. A `clsArena` hands out memory from a few large blocks instead: allocating is a pointer bump,
+ * nothing is freed individually, and destroying the arena releases the handful of blocks at once.
+ *
+ * The arena-aware record types (`stClientView`, `stUserView`, `stLoginRecordView`,
+ * `stTransferRecordView`) hold `string_view` fields that point into an arena, so a whole load
+ * costs a few large allocations and its teardown is O(1).
+ *
+ * ## Usage
+ * ```cpp
+ * clsArena arena;
+ * clsArenaVector <stClientView> vClients = clsBankClient::getClientViews(ClientsDataFile, arena);
+ * // ... print vClients; everything is released with `arena`.
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - Blocks start at 64 KB and double, so N bytes take O(log N) blocks; a request larger than the
+ *   next block gets a block of its own size.
+ * - Only trivially destructible types may live in an arena: their destructors are never run.
+ * - An arena is not thread-safe; parallel loaders allocate up front and fill the memory from workers.
+ * - Views into an arena must not outlive it.
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+using namespace std;
+
+class clsArena
+{
+private:
+    struct stBlock
+    {
+        unique_ptr<char[]> data;
+        size_t size = 0;
+    };
+
+    vector <stBlock> _vBlocks;
+    size_t _used = 0;
+    size_t _nextBlockBytes;
+    size_t _bytesAllocated = 0;
+
+    void _addBlock(size_t minBytes)
+    {
+        size_t size = max(_nextBlockBytes, minBytes);
+
+        _vBlocks.push_back({unique_ptr<char[]>(new char[size]), size});
+        _used = 0;
+        _nextBlockBytes = size * 2;
+    }
+
+public:
+    explicit clsArena(size_t firstBlockBytes = 64 * 1024) : _nextBlockBytes(max<size_t>(firstBlockBytes, 64))
+    {
+    }
+
+    clsArena(const clsArena &) = delete;
+    clsArena & operator=(const clsArena &) = delete;
+
+    /**
+     * @brief Returns `bytes` bytes aligned to `alignment`; the memory lives until the arena is reset or destroyed.
+     */
+    void * allocate(size_t bytes, size_t alignment = alignof(max_align_t))
+    {
+        if (!_vBlocks.empty())
+        {
+            stBlock & block = _vBlocks.back();
+            size_t start = (_used + alignment - 1) & ~(alignment - 1);
+
+            if (start + bytes <= block.size)
+            {
+                _used = start + bytes;
+                _bytesAllocated += bytes;
+                return block.data.get() + start;
+            }
+        }
+
+        // new blocks come from `new char[]`, which is aligned for any fundamental type.
+        _addBlock(bytes + alignment);
+        return allocate(bytes, alignment);
+    }
+
+    /**
+     * @brief Allocates an uninitialized array of a trivially destructible type.
+     */
+    template <typename T>
+    T * allocateArray(size_t count)
+    {
+        static_assert(is_trivially_destructible<T>::value, "arena objects are never destroyed");
+        return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * @brief Copies a string into the arena.
+     * @return A view of the copy.
+     */
+    string_view copyString(string_view text)
+    {
+        if (text.empty()) return string_view();
+
+        char * copy = static_cast<char *>(allocate(text.size(), 1));
+        memcpy(copy, text.data(), text.size());
+        return string_view(copy, text.size());
+    }
+
+    /**
+     * @brief Forgets every allocation, keeping only the largest block for reuse.
+     */
+    void reset()
+    {
+        if (_vBlocks.size() > 1)
+        {
+            stBlock largest = move(_vBlocks.back());
+            _vBlocks.clear();
+            _vBlocks.push_back(move(largest));
+        }
+        _used = 0;
+        _bytesAllocated = 0;
+    }
+
+    size_t getBlockCount() const
+    {
+        return _vBlocks.size();
+    }
+
+    size_t getBytesAllocated() const
+    {
+        return _bytesAllocated;
+    }
+};
+
+/**
+ * @class clsArenaAllocator
+ * @brief A standard allocator that takes its memory from a `clsArena` and never frees it.
+ */
+template <typename T>
+class clsArenaAllocator
+{
+public:
+    using value_type = T;
+
+    clsArena * arena;
+
+    clsArenaAllocator(clsArena & arenaToUse) : arena(&arenaToUse)
+    {
+    }
+
+    template <typename U>
+    clsArenaAllocator(const clsArenaAllocator<U> & other) : arena(other.arena)
+    {
+    }
+
+    T * allocate(size_t count)
+    {
+        return static_cast<T *>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *, size_t)
+    {
+    }
+
+    template <typename U>
+    bool operator==(const clsArenaAllocator<U> & other) const
+    {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const clsArenaAllocator<U> & other) const
+    {
+        return arena != other.arena;
+    }
+};
+
+/**
+ * @brief A vector stored in an arena; `reserve()` the final size up front, since grown-out buffers are not reused.
+ */
+template <typename T>
+using clsArenaVector = vector <T, clsArenaAllocator<T>>;
@@ -0,0 +1,135 @@
+/**
+ * @file clsBloomFilter.h
+ * @brief Declares the `clsBloomFilter` class, a compact probabilistic set of string keys.
+ *
+ * ## Overview
+ * A Bloom filter answers "is this key in the set?" with either **"definitely not"** or
+ * **"maybe"**, using about 10 bits per key and a handful of hash probes. It is used in front of
+ * the exact key index to answer most uniqueness checks (a new account number, a new user name)
+ * without touching the data file at all.
+ *
+ * ## Notable Implementation Details
+ * - Sized for ~1% false positives: 10 bits per expected key and 7 hash functions.
+ * - The 7 probe positions are derived from one 64-bit FNV-1a hash by double hashing.
+ * - Keys cannot be removed; a deleted key only costs an extra false positive until the filter is rebuilt.
+ * - `writeTo()` / `readFrom()` store the bit array as raw 64-bit words (native byte order).
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+using namespace std;
+
+class clsBloomFilter
+{
+private:
+    static const int _bitsPerKey = 10;
+    static const int _hashCount = 7;
+
+    vector <uint64_t> _vWords;
+    uint64_t _bitCount = 0;
+    uint64_t _keyCount = 0;
+
+    static uint64_t _hash(const string& key)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char character : key)
+        {
+            hash ^= character;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+public:
+    /**
+     * @brief Creates an empty filter sized for the given number of keys.
+     */
+    explicit clsBloomFilter(uint64_t expectedKeys = 0)
+    {
+        reset(expectedKeys);
+    }
+
+    /**
+     * @brief Empties the filter and resizes it for the given number of keys.
+     */
+    void reset(uint64_t expectedKeys)
+    {
+        uint64_t words = max<uint64_t>(16, (expectedKeys * _bitsPerKey + 63) / 64);
+
+        _vWords.assign(words, 0);
+        _bitCount = words * 64;
+        _keyCount = 0;
+    }
+
+    void add(const string& key)
+    {
+        uint64_t hash = _hash(key);
+        uint64_t step = (hash >> 33) | 1;
+
+        for (int i = 0; i < _hashCount; i++)
+        {
+            uint64_t bit = (hash + i * step) % _bitCount;
+            _vWords[bit / 64] |= (1ULL << (bit % 64));
+        }
+        _keyCount++;
+    }
+
+    /**
+     * @return false if the key was definitely never added, true if it may have been.
+     */
+    bool mightContain(const string& key) const
+    {
+        uint64_t hash = _hash(key);
+        uint64_t step = (hash >> 33) | 1;
+
+        for (int i = 0; i < _hashCount; i++)
+        {
+            uint64_t bit = (hash + i * step) % _bitCount;
+            if ((_vWords[bit / 64] & (1ULL << (bit % 64))) == 0)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks whether more keys were added than the filter was sized for (false positives climb).
+     */
+    bool isOverloaded() const
+    {
+        return _keyCount * _bitsPerKey > _bitCount * 2;
+    }
+
+    uint64_t getKeyCount() const
+    {
+        return _keyCount;
+    }
+
+    void writeTo(ostream & out) const
+    {
+        out << _bitCount << ' ' << _keyCount << '\n';
+        out.write(reinterpret_cast<const char *>(_vWords.data()), _vWords.size() * sizeof(uint64_t));
+    }
+
+    /**
+     * @return false if the stream does not hold a complete filter.
+     */
+    bool readFrom(istream & in)
+    {
+        uint64_t bitCount = 0, keyCount = 0;
+
+        if (!(in >> bitCount >> keyCount) || in.get() != '\n' || bitCount == 0 || bitCount % 64 != 0)
+            return false;
+
+        vector <uint64_t> vWords(bitCount / 64);
+        if (!in.read(reinterpret_cast<char *>(vWords.data()), vWords.size() * sizeof(uint64_t)))
+            return false;
+
+        _vWords.swap(vWords);
+        _bitCount = bitCount;
+        _keyCount = keyCount;
+        return true;
+    }
+};
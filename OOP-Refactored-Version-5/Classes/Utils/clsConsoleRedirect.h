@@ -0,0 +1,73 @@
+/**
+ * @file clsConsoleRedirect.h
+ * @brief Declares the `clsConsoleRedirect` class for running the screens against scripted input.
+ *
+ * ## Overview
+ * Every screen reads its input through `cin` (`clsInputValidation::readString()`,
+ * `clsInputValidation::readDblNumber()`, `clsUtil::confirm()`) and writes to `cout`.
+ * `clsConsoleRedirect` swaps the stream buffers behind `cin` and `cout` for the lifetime
+ * of the object, so the same screens can be driven headless from a recorded keystroke script.
+ *
+ * ## Notable Implementation Details
+ * - While redirected, `cin` throws `ios_base::failure` once the script is exhausted, instead of
+ *   letting the validation loops spin forever on an empty stream.
+ * - The original buffers, state and exception mask are restored by the destructor.
+ */
+#pragma once
+#include <iostream>
+#include <streambuf>
+using namespace std;
+
+class clsConsoleRedirect
+{
+private:
+    /**
+     * @brief A stream buffer that swallows everything written to it (headless output).
+     */
+    class clsNullBuffer : public streambuf
+    {
+    protected:
+        int overflow(int ch) override
+        {
+            return traits_type::not_eof(ch);
+        }
+
+        streamsize xsputn(const char *, streamsize count) override
+        {
+            return count;
+        }
+    };
+
+    streambuf *_oldInput, *_oldOutput;
+    ios::iostate _oldExceptions;
+    clsNullBuffer _nullBuffer;
+
+public:
+    /**
+     * @brief Redirects `cin` to the given buffer and silences `cout`.
+     *
+     * @param input The buffer holding the scripted keystrokes.
+     * @param output Optional buffer to receive the screens output, discarded when null.
+     */
+    clsConsoleRedirect(streambuf *input, streambuf *output = nullptr)
+    {
+        _oldExceptions = cin.exceptions();
+        _oldInput = cin.rdbuf(input);
+        _oldOutput = cout.rdbuf(output ? output : &_nullBuffer);
+
+        cin.clear();
+        cin.exceptions(ios::eofbit | ios::badbit);
+    }
+
+    ~clsConsoleRedirect()
+    {
+        cin.exceptions(ios::goodbit);
+        cin.rdbuf(_oldInput);
+        cin.clear();
+        cin.exceptions(_oldExceptions);
+        cout.rdbuf(_oldOutput);
+    }
+
+    clsConsoleRedirect(const clsConsoleRedirect &) = delete;
+    clsConsoleRedirect & operator=(const clsConsoleRedirect &) = delete;
+};
@@ -729,6 +729,29 @@ public:
         return DateToString(date) + " - " + HourToString(date);
     }
 
+    // packs a TimeToString() timestamp ("D/M/YYYY - H:M:S") into YYYYMMDDHHMMSS, so timestamps compare as integers.
+    static int64_t timestampKey(string_view timestamp)
+    {
+        string_view arDate[3], arTime[3];
+        if (clsString::splitView(timestamp, arDate, 3, "/") != 3) return 0;
+
+        size_t timeStart = arDate[2].find(" - ");
+        string_view time = timeStart == string_view::npos ? string_view() : arDate[2].substr(timeStart + 3);
+        clsString::splitView(time, arTime, 3, ":");
+
+        int64_t key = (int64_t)clsString::parseDouble(arDate[2]);
+        for (string_view part : {arDate[1], arDate[0], arTime[0], arTime[1], arTime[2]})
+            key = key * 100 + (int64_t)clsString::parseDouble(part);
+
+        return key;
+    }
+
+    // the timestampKey() of the last second of a day.
+    static int64_t endOfDayKey(clsDate date)
+    {
+        return ((int64_t)date.getYear() * 10000 + date.getMonth() * 100 + date.getDay()) * 1000000 + 235959;
+    }
+
     static bool isOverlapPeriods(stPeriodDates period1, stPeriodDates period2);
 
     static int getPeriodDaysLength(stPeriodDates period, bool includeLastDay = false);
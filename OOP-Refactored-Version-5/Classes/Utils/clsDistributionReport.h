@@ -0,0 +1,361 @@
+/**
+ * @file clsDistributionReport.h
+ * @brief Declares the `clsDistributionReport` class, which summarizes a column of numbers in parallel.
+ *
+ * ## Overview
+ * Risk reporting needs more than a total: how the balances are distributed. Given one column of
+ * values (e.g. every client's balance), `build()` computes in parallel:
+ * - the count, sum, minimum, maximum and mean;
+ * - a **histogram** with configurable bins: `binCount` bins of `binWidth` starting at `lower`,
+ *   plus a bin for the values below and one for the values above; every bin has its count and sum;
+ * - **quantiles**, either exact (parallel selection, see `selectRank()`) or approximate
+ *   (one `clsQuantileSketch` per chunk, merged).
+ *
+ * `writeCsv()` exports a report for other tools.
+ *
+ * ## Usage
+ * ```cpp
+ * stHistogramSpec spec {0, 1000, 10};
+ * stDistributionReport report = clsDistributionReport::build(vBalances, spec, {0.5, 0.99}, true);
+ * report.vQuantiles[1].value;   // the exact 99th percentile
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The column is split into `2 x threads` chunks (none under `_minParallelCount` values); every
+ *   chunk fills its own partial histogram and sketch, which are merged on the calling thread.
+ * - Quantiles use the nearest-rank definition: the `q`-quantile is the `ceil(q * n)`-th smallest value.
+ * - `selectRank()` is a parallel quickselect: the workers count the values below and equal to a
+ *   sampled pivot, the side holding the rank is copied out in parallel, and the loop goes on with
+ *   it until it is small enough for `nth_element()`. The input column is never modified.
+ * - Sums are accumulated in `long double` per chunk so that millions of balances add up without
+ *   visible rounding.
+ */
+#pragma once
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include "clsThreadPool.h"
+#include "clsQuantileSketch.h"
+using namespace std;
+
+/**
+ * @struct stHistogramSpec
+ * @brief The regular bins of a histogram: `binCount` bins of `binWidth`, starting at `lower`.
+ */
+struct stHistogramSpec
+{
+    double lower = 0;
+    double binWidth = 1000;
+    size_t binCount = 10;
+};
+
+/**
+ * @struct stHistogramBin
+ * @brief One histogram bin: values in `[from, to)`; the first bin has no lower end, the last no upper end.
+ */
+struct stHistogramBin
+{
+    string label;
+    double from = 0, to = 0;
+    size_t count = 0;
+    long double sum = 0;
+};
+
+struct stQuantile
+{
+    double q = 0;
+    double value = 0;
+};
+
+struct stDistributionReport
+{
+    size_t count = 0;
+    long double sum = 0;
+    double minValue = 0, maxValue = 0;
+    vector <stHistogramBin> vBins;
+    vector <stQuantile> vQuantiles;
+    bool exactQuantiles = true;
+
+    double mean() const
+    {
+        return count == 0 ? 0 : double(sum / count);
+    }
+};
+
+class clsDistributionReport
+{
+private:
+    static const size_t _minParallelCount = 32 * 1024;
+    static const size_t _sequentialSelectCount = 64 * 1024;
+    static const size_t _pivotSampleCount = 63;
+
+    static size_t _chunkCount(size_t count, clsThreadPool & pool)
+    {
+        if (count < _minParallelCount) return 1;
+        return min(pool.getThreadCount() * 2, count / (_minParallelCount / 2));
+    }
+
+    static string _formatAmount(double amount)
+    {
+        ostringstream out;
+        out << fixed << setprecision(0) << amount;
+        return out.str();
+    }
+
+    static vector <stHistogramBin> _emptyBins(const stHistogramSpec & spec)
+    {
+        vector <stHistogramBin> vBins(spec.binCount + 2);
+        double upper = spec.lower + spec.binWidth * spec.binCount;
+
+        vBins.front().label = "Below " + _formatAmount(spec.lower);
+        vBins.front().from = -INFINITY;
+        vBins.front().to = spec.lower;
+
+        for (size_t bin = 0; bin < spec.binCount; bin++)
+        {
+            stHistogramBin & histogramBin = vBins[bin + 1];
+            histogramBin.from = spec.lower + spec.binWidth * bin;
+            histogramBin.to = spec.lower + spec.binWidth * (bin + 1);
+            histogramBin.label = _formatAmount(histogramBin.from) + " - " + _formatAmount(histogramBin.to);
+        }
+
+        vBins.back().label = _formatAmount(upper) + " and above";
+        vBins.back().from = upper;
+        vBins.back().to = INFINITY;
+        return vBins;
+    }
+
+    static size_t _binOf(double value, const stHistogramSpec & spec)
+    {
+        if (value < spec.lower) return 0;
+
+        double bin = floor((value - spec.lower) / spec.binWidth);
+        return bin >= spec.binCount ? spec.binCount + 1 : size_t(bin) + 1;
+    }
+
+    static double _pivotOf(const double * values, size_t count, mt19937_64 & random)
+    {
+        vector <double> vSample(_pivotSampleCount);
+        uniform_int_distribution <size_t> position(0, count - 1);
+
+        for (double & sample : vSample)
+            sample = values[position(random)];
+
+        nth_element(vSample.begin(), vSample.begin() + _pivotSampleCount / 2, vSample.end());
+        return vSample[_pivotSampleCount / 2];
+    }
+
+public:
+    /**
+     * @brief Names a quantile as a percentile, e.g. "p50", "p99.5".
+     */
+    static string quantileLabel(double q)
+    {
+        ostringstream out;
+        out << "p" << q * 100;
+        return out.str();
+    }
+
+    /**
+     * @brief Returns the value of rank `rank` (0-based) in ascending order, without sorting.
+     *
+     * @param values The column; it is not modified.
+     * @param rank Must be below `values.size()`.
+     */
+    static double selectRank(const vector <double> & values, size_t rank, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        const double * data = values.data();
+        size_t count = values.size();
+        vector <double> vCandidates, vNextCandidates;
+        mt19937_64 random(count);
+
+        while (count > _sequentialSelectCount)
+        {
+            double pivot = _pivotOf(data, count, random);
+
+            size_t chunkCount = _chunkCount(count, pool);
+            vector <size_t> vBelow(chunkCount), vEqual(chunkCount);
+
+            // 1. count, per chunk, the values below and equal to the pivot.
+            pool.parallelFor(chunkCount, [&](size_t chunk)
+            {
+                size_t begin = count * chunk / chunkCount, end = count * (chunk + 1) / chunkCount;
+                size_t below = 0, equal = 0;
+
+                for (size_t i = begin; i < end; i++)
+                {
+                    below += data[i] < pivot;
+                    equal += data[i] == pivot;
+                }
+                vBelow[chunk] = below;
+                vEqual[chunk] = equal;
+            });
+
+            size_t below = 0, equal = 0;
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+            {
+                below += vBelow[chunk];
+                equal += vEqual[chunk];
+            }
+
+            if (rank >= below && rank < below + equal) return pivot;
+
+            // 2. keep the side holding the rank; every chunk copies its part at its own offset.
+            bool keepBelow = rank < below;
+            vector <size_t> vOffsets(chunkCount + 1, 0);
+
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+            {
+                size_t above = (count * (chunk + 1) / chunkCount - count * chunk / chunkCount) - vBelow[chunk] - vEqual[chunk];
+                vOffsets[chunk + 1] = vOffsets[chunk] + (keepBelow ? vBelow[chunk] : above);
+            }
+
+            vNextCandidates.resize(vOffsets.back());
+
+            pool.parallelFor(chunkCount, [&](size_t chunk)
+            {
+                size_t begin = count * chunk / chunkCount, end = count * (chunk + 1) / chunkCount;
+                double * out = vNextCandidates.data() + vOffsets[chunk];
+
+                for (size_t i = begin; i < end; i++)
+                {
+                    if (keepBelow ? data[i] < pivot : data[i] > pivot)
+                        *out++ = data[i];
+                }
+            });
+
+            if (!keepBelow) rank -= below + equal;
+
+            vCandidates.swap(vNextCandidates);
+            data = vCandidates.data();
+            count = vCandidates.size();
+        }
+
+        vector <double> vLast(data, data + count);
+        nth_element(vLast.begin(), vLast.begin() + rank, vLast.end());
+        return vLast[rank];
+    }
+
+    /**
+     * @brief Returns the exact `q`-quantile (nearest rank) of the column; 0 for an empty column.
+     */
+    static double exactQuantile(const vector <double> & values, double q, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        if (values.empty()) return 0;
+
+        size_t rank = q <= 0 ? 0 : min(values.size(), (size_t)ceil(q * values.size())) - 1;
+        return selectRank(values, rank, pool);
+    }
+
+    /**
+     * @brief Summarizes a column: count, sum, extremes, histogram and quantiles.
+     *
+     * @param quantiles The quantiles to compute, each in [0, 1] (e.g. 0.5 for the median).
+     * @param exact True for exact quantiles (parallel selection), false for merged sketches.
+     */
+    static stDistributionReport build(const vector <double> & values, const stHistogramSpec & spec, const vector <double> & quantiles,
+                                      bool exact, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        stDistributionReport report;
+        report.count = values.size();
+        report.exactQuantiles = exact;
+        report.vBins = _emptyBins(spec);
+
+        size_t chunkCount = _chunkCount(values.size(), pool);
+
+        struct stPartial
+        {
+            vector <stHistogramBin> vBins;
+            clsQuantileSketch sketch;
+            long double sum = 0;
+            double minValue = INFINITY, maxValue = -INFINITY;
+        };
+        vector <stPartial> vPartials(chunkCount);
+
+        // 1. one pass per chunk: partial sums, extremes, histogram and (approximate mode) sketch.
+        pool.parallelFor(chunkCount, [&](size_t chunk)
+        {
+            stPartial & partial = vPartials[chunk];
+            partial.vBins.resize(report.vBins.size());
+
+            size_t begin = values.size() * chunk / chunkCount, end = values.size() * (chunk + 1) / chunkCount;
+
+            for (size_t i = begin; i < end; i++)
+            {
+                double value = values[i];
+                stHistogramBin & bin = partial.vBins[_binOf(value, spec)];
+
+                bin.count++;
+                bin.sum += value;
+                partial.sum += value;
+                partial.minValue = min(partial.minValue, value);
+                partial.maxValue = max(partial.maxValue, value);
+
+                if (!exact) partial.sketch.add(value);
+            }
+        });
+
+        // 2. merge the partials.
+        clsQuantileSketch sketch;
+        double minValue = INFINITY, maxValue = -INFINITY;
+
+        for (const stPartial & partial : vPartials)
+        {
+            for (size_t bin = 0; bin < report.vBins.size(); bin++)
+            {
+                report.vBins[bin].count += partial.vBins[bin].count;
+                report.vBins[bin].sum += partial.vBins[bin].sum;
+            }
+            report.sum += partial.sum;
+            minValue = min(minValue, partial.minValue);
+            maxValue = max(maxValue, partial.maxValue);
+
+            if (!exact) sketch.merge(partial.sketch);
+        }
+
+        if (report.count > 0)
+        {
+            report.minValue = minValue;
+            report.maxValue = maxValue;
+        }
+
+        for (double q : quantiles)
+            report.vQuantiles.push_back({q, exact ? exactQuantile(values, q, pool) : sketch.quantile(q)});
+
+        return report;
+    }
+
+    /**
+     * @brief Writes a report as CSV: one `Section,Label,From,To,Count,Sum,Value` row per figure.
+     */
+    static void writeCsv(ostream & out, const stDistributionReport & report)
+    {
+        out << fixed << setprecision(2);
+        out << "Section,Label,From,To,Count,Sum,Value\n";
+
+        out << "Summary,Count,,," << report.count << "," << report.sum << ",\n";
+        out << "Summary,Minimum,,,,," << report.minValue << "\n";
+        out << "Summary,Maximum,,,,," << report.maxValue << "\n";
+        out << "Summary,Mean,,,,," << report.mean() << "\n";
+
+        for (const stHistogramBin & bin : report.vBins)
+        {
+            out << "Histogram,\"" << bin.label << "\",";
+            if (isfinite(bin.from)) out << bin.from;
+            out << ",";
+            if (isfinite(bin.to)) out << bin.to;
+            out << "," << bin.count << "," << bin.sum << ",\n";
+        }
+
+        for (const stQuantile & quantile : report.vQuantiles)
+        {
+            out << "Quantile," << quantileLabel(quantile.q)
+                << (report.exactQuantiles ? " (exact)" : " (approximate)") << ",,,,," << quantile.value << "\n";
+        }
+    }
+};
@@ -0,0 +1,446 @@
+/**
+ * @file clsExternalSorter.h
+ * @brief Declares the `clsExternalSorter` class, which sorts the lines of a text file larger than memory.
+ *
+ * ## Overview
+ * `sortFile()` is a classic external merge sort in two phases:
+ * 1. **Runs**: the input is read in blocks of half the memory budget; the keys of every block
+ *    are extracted in parallel, the block is ordered with `clsParallelOrder::sortedPermutation()`,
+ *    and written out as a sorted run file.
+ * 2. **Merge**: the runs are merged k ways through a `clsLoserTree`, each run read through its own
+ *    buffer. More than `_maxFanIn` runs are first merged in groups into longer runs (one extra pass).
+ *
+ * ## Usage
+ * ```cpp
+ * // the lines of Transfer.txt ordered by their second field.
+ * clsExternalSorter::sortFile("Transfer.txt", "Transfer.sorted.txt", [](string_view line)
+ * {
+ *     string_view arFields[2];
+ *     clsString::splitView(line, arFields, 2, "#//#");
+ *     return arFields[1];
+ * });
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - `keyOf(line)` may return a view into the line (the line outlives its key) and is called
+ *   concurrently from the pool workers; keys are compared with `<`.
+ * - The sort is stable: lines with equal keys keep their input order (the runs break ties by
+ *   line number, the merge by run number).
+ * - Empty lines are dropped, and every output line ends with a new line.
+ * - The output is written to a temporary file renamed over `outputFile` at the end, and the run
+ *   files (written next to the output) are removed as soon as they are merged.
+ * - A single run is renamed to the output directly, without a merge pass.
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include "clsThreadPool.h"
+#include "clsParallelOrder.h"
+#include "clsLoserTree.h"
+#include "clsTracer.h"
+using namespace std;
+
+/**
+ * @struct stExternalSortStats
+ * @brief What one external sort read, wrote and how long each phase took.
+ */
+struct stExternalSortStats
+{
+    uint64_t lines = 0;
+    uint64_t bytes = 0;
+    size_t runs = 0;
+    size_t mergePasses = 0;
+    double runSeconds = 0;
+    double mergeSeconds = 0;
+};
+
+class clsExternalSorter
+{
+private:
+    static const size_t _maxFanIn = 256;
+    static const size_t _maxReadBufferBytes = 1024 * 1024;
+    static const size_t _writeBufferBytes = 4 * 1024 * 1024;
+    static const size_t _minParallelLines = 64 * 1024;
+
+    /**
+     * @brief Reads a file line by line through one large buffer.
+     */
+    class _clsLineReader
+    {
+    private:
+        fstream _file;
+        string _buffer;
+        size_t _position = 0;
+        size_t _bufferBytes = _maxReadBufferBytes;
+
+    public:
+        string line;
+
+        bool open(const string& fileName, size_t bufferBytes)
+        {
+            _bufferBytes = max<size_t>(4096, bufferBytes);
+            _file.open(fileName, ios::in | ios::binary);
+            return _file.is_open();
+        }
+
+        /**
+         * @brief Moves `line` to the next non-empty line; returns false at the end of the file.
+         */
+        bool next()
+        {
+            while (true)
+            {
+                size_t lineEnd = _buffer.find('\n', _position);
+
+                if (lineEnd != string::npos)
+                {
+                    line.assign(_buffer, _position, lineEnd - _position);
+                    _position = lineEnd + 1;
+
+                    if (line.empty()) continue;
+                    return true;
+                }
+
+                // the unfinished line moves to the front and the rest of the buffer is refilled.
+                _buffer.erase(0, _position);
+                _position = 0;
+
+                size_t kept = _buffer.size();
+                _buffer.resize(kept + _bufferBytes);
+                _file.read(&_buffer[kept], _bufferBytes);
+                _buffer.resize(kept + _file.gcount());
+
+                if (_buffer.size() == kept)
+                {
+                    // the last line of a file without a final new line.
+                    line.swap(_buffer);
+                    _buffer.clear();
+                    return !line.empty();
+                }
+            }
+        }
+
+        void close()
+        {
+            _file.close();
+        }
+    };
+
+    /**
+     * @brief Collects output lines and writes them in large blocks.
+     */
+    class _clsBlockWriter
+    {
+    private:
+        fstream _file;
+        string _buffer;
+
+    public:
+        bool open(const string& fileName)
+        {
+            _file.open(fileName, ios::out | ios::binary | ios::trunc);
+            _buffer.reserve(_writeBufferBytes + 4096);
+            return _file.is_open();
+        }
+
+        void writeLine(string_view line)
+        {
+            _buffer.append(line);
+            _buffer += '\n';
+
+            if (_buffer.size() >= _writeBufferBytes)
+                flush();
+        }
+
+        void flush()
+        {
+            _file.write(_buffer.data(), _buffer.size());
+            _buffer.clear();
+        }
+
+        /**
+         * @return false when any write failed.
+         */
+        bool close()
+        {
+            flush();
+            _file.close();
+            return !_file.fail();
+        }
+    };
+
+    static void _removeFiles(const vector <string> & vFileNames)
+    {
+        error_code error;
+        for (const string & fileName : vFileNames)
+            filesystem::remove(fileName, error);
+    }
+
+    /**
+     * @brief Sorts the lines of one block and writes them as a run file.
+     */
+    template <typename KeyOf>
+    static bool _writeRun(string_view block, const string& runFileName, KeyOf & keyOf, uint64_t & lineCount, clsThreadPool & pool)
+    {
+        using Key = decltype(keyOf(string_view()));
+
+        vector <string_view> vLines;
+        size_t begin = 0;
+        while (begin < block.size())
+        {
+            size_t lineEnd = block.find('\n', begin);
+            if (lineEnd == string_view::npos) lineEnd = block.size();
+
+            if (lineEnd > begin)
+                vLines.push_back(block.substr(begin, lineEnd - begin));
+            begin = lineEnd + 1;
+        }
+
+        vector <Key> vKeys(vLines.size());
+        size_t chunkCount = vLines.size() < _minParallelLines ? 1 : pool.getThreadCount() * 2;
+
+        pool.parallelFor(chunkCount, [&](size_t chunk)
+        {
+            size_t end = vLines.size() * (chunk + 1) / chunkCount;
+            for (size_t i = vLines.size() * chunk / chunkCount; i < end; i++)
+                vKeys[i] = keyOf(vLines[i]);
+        });
+
+        vector <uint32_t> vOrder = clsParallelOrder::sortedPermutation(vLines.size(),
+            [&vKeys](uint32_t a, uint32_t b) { return vKeys[a] < vKeys[b]; }, pool);
+
+        _clsBlockWriter writer;
+        if (!writer.open(runFileName)) return false;
+
+        for (uint32_t line : vOrder)
+            writer.writeLine(vLines[line]);
+
+        lineCount += vLines.size();
+        return writer.close();
+    }
+
+    /**
+     * @brief Phase 1: cuts the input into sorted run files.
+     */
+    template <typename KeyOf>
+    static bool _writeRuns(const string& inputFile, const string& runPrefix, size_t memoryBudget, KeyOf & keyOf,
+                           vector <string> & vRunFiles, stExternalSortStats & stats, clsThreadPool & pool)
+    {
+        clsTraceSpan span("clsExternalSorter::_writeRuns");
+
+        fstream myFile;
+        myFile.open(inputFile, ios::in | ios::binary);
+        if (!myFile.is_open()) return false;
+
+        // the block, its line views, keys and permutation share the budget.
+        size_t blockBytes = max<size_t>(1024 * 1024, memoryBudget / 2);
+        string block, carried;
+
+        while (true)
+        {
+            // the block starts with the unfinished last line of the previous one.
+            block.swap(carried);
+            carried.clear();
+
+            size_t kept = block.size();
+            block.resize(kept + blockBytes);
+            myFile.read(&block[kept], blockBytes);
+
+            size_t readBytes = myFile.gcount();
+            bool lastBlock = readBytes < blockBytes;
+
+            block.resize(kept + readBytes);
+            stats.bytes += readBytes;
+
+            // a block without any new line (npos + 1 == 0) is carried whole and extended by the next read.
+            size_t end = lastBlock ? block.size() : block.rfind('\n') + 1;
+            carried.assign(block, end, string::npos);
+
+            if (end != 0)
+            {
+                string runFileName = runPrefix + to_string(vRunFiles.size());
+                vRunFiles.push_back(runFileName);
+
+                if (!_writeRun(string_view(block).substr(0, end), runFileName, keyOf, stats.lines, pool))
+                    return false;
+            }
+
+            if (lastBlock) break;
+        }
+        myFile.close();
+
+        return true;
+    }
+
+    /**
+     * @brief Merges sorted run files into one sorted file with a loser tree.
+     */
+    template <typename KeyOf>
+    static bool _mergeRuns(const vector <string> & vRunFiles, const string& outputFile, size_t memoryBudget, KeyOf & keyOf)
+    {
+        clsTraceSpan span("clsExternalSorter::_mergeRuns");
+        using Key = decltype(keyOf(string_view()));
+
+        size_t runCount = vRunFiles.size();
+        size_t bufferBytes = min(_maxReadBufferBytes, memoryBudget / (runCount + 1));
+
+        vector <_clsLineReader> vReaders(runCount);
+        vector <Key> vKeys(runCount);
+
+        clsLoserTree tree(runCount, [&vKeys](size_t a, size_t b) { return vKeys[a] < vKeys[b]; });
+
+        for (size_t run = 0; run < runCount; run++)
+        {
+            if (!vReaders[run].open(vRunFiles[run], bufferBytes)) return false;
+
+            if (vReaders[run].next())
+                vKeys[run] = keyOf(vReaders[run].line);
+            else
+                tree.markExhausted(run);
+        }
+        tree.build();
+
+        _clsBlockWriter writer;
+        if (!writer.open(outputFile)) return false;
+
+        while (!tree.empty())
+        {
+            size_t run = tree.winner();
+            writer.writeLine(vReaders[run].line);
+
+            if (vReaders[run].next())
+                vKeys[run] = keyOf(vReaders[run].line);
+            else
+                tree.markExhausted(run);
+
+            tree.replay(run);
+        }
+
+        for (_clsLineReader & reader : vReaders)
+            reader.close();
+
+        return writer.close();
+    }
+
+public:
+    static const size_t defaultMemoryBudget = 256 * 1024 * 1024;
+
+    /**
+     * @brief Writes the lines of `inputFile` to `outputFile`, ordered by `keyOf(line)`.
+     *
+     * @param keyOf `Key(string_view line)`, called concurrently from the pool workers.
+     * @param memoryBudget The bytes of input sorted in memory at a time (half of it is one block).
+     * @param stats Optional; receives the line count, the number of runs and passes and the time of each phase.
+     * @return false when the input cannot be read or a run or the output cannot be written.
+     */
+    template <typename KeyOf>
+    static bool sortFile(const string& inputFile, const string& outputFile, KeyOf keyOf, size_t memoryBudget = defaultMemoryBudget,
+                         stExternalSortStats * stats = nullptr, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        clsTraceSpan span("clsExternalSorter::sortFile");
+        using clock = chrono::steady_clock;
+
+        stExternalSortStats sortStats;
+        vector <string> vRunFiles;
+        string tempFile = outputFile + ".tmp";
+
+        clock::time_point start = clock::now();
+        bool succeeded = _writeRuns(inputFile, outputFile + ".run-0-", memoryBudget, keyOf, vRunFiles, sortStats, pool);
+        clock::time_point runsWritten = clock::now();
+
+        sortStats.runs = vRunFiles.size();
+
+        // too many runs for one merge: merge them in groups into longer runs first.
+        for (size_t pass = 1; succeeded && vRunFiles.size() > _maxFanIn; pass++)
+        {
+            vector <string> vMergedRuns;
+
+            for (size_t first = 0; succeeded && first < vRunFiles.size(); first += _maxFanIn)
+            {
+                vector <string> vGroup(vRunFiles.begin() + first, vRunFiles.begin() + min(first + _maxFanIn, vRunFiles.size()));
+                string mergedRun = outputFile + ".run-" + to_string(pass) + "-" + to_string(vMergedRuns.size());
+
+                succeeded = _mergeRuns(vGroup, mergedRun, memoryBudget, keyOf);
+                vMergedRuns.push_back(mergedRun);
+                _removeFiles(vGroup);
+            }
+
+            // after a failed merge, the groups that were not reached yet are dropped as well.
+            if (!succeeded) _removeFiles(vRunFiles);
+
+            vRunFiles.swap(vMergedRuns);
+            sortStats.mergePasses++;
+        }
+
+        if (succeeded)
+        {
+            error_code error;
+
+            if (vRunFiles.size() == 1)
+            {
+                filesystem::rename(vRunFiles[0], tempFile, error);
+                succeeded = !error;
+            }
+            else
+            {
+                succeeded = _mergeRuns(vRunFiles, tempFile, memoryBudget, keyOf);
+                sortStats.mergePasses++;
+            }
+
+            if (succeeded)
+            {
+                filesystem::rename(tempFile, outputFile, error);
+                succeeded = !error;
+            }
+        }
+
+        _removeFiles(vRunFiles);
+        if (!succeeded) _removeFiles({tempFile});
+
+        sortStats.runSeconds = chrono::duration<double>(runsWritten - start).count();
+        sortStats.mergeSeconds = chrono::duration<double>(clock::now() - runsWritten).count();
+
+        if (stats != nullptr) *stats = sortStats;
+        return succeeded;
+    }
+
+    /**
+     * @brief Returns whether the lines of a file are ordered by `keyOf(line)`.
+     *
+     * @param lineCount Optional; receives the number of non-empty lines.
+     */
+    template <typename KeyOf>
+    static bool isSorted(const string& fileName, KeyOf keyOf, uint64_t * lineCount = nullptr)
+    {
+        using Key = decltype(keyOf(string_view()));
+
+        _clsLineReader reader;
+        if (!reader.open(fileName, _maxReadBufferBytes)) return false;
+
+        string previousLine;
+        uint64_t lines = 0;
+        bool sorted = true;
+
+        while (reader.next())
+        {
+            if (lines > 0)
+            {
+                Key previousKey = keyOf(previousLine);
+                if (keyOf(reader.line) < previousKey) sorted = false;
+            }
+
+            previousLine.swap(reader.line);
+            lines++;
+        }
+        reader.close();
+
+        if (lineCount != nullptr) *lineCount = lines;
+        return sorted;
+    }
+};
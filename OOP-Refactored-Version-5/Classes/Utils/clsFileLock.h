@@ -0,0 +1,106 @@
+/**
+ * @file clsFileLock.h
+ * @brief Declares the `clsFileLock` class, an exclusive lock shared by every process of the program.
+ *
+ * ## Overview
+ * A `mutex` only serializes the threads of one process, but several terminals run the program on
+ * the same data files. `clsFileLock` locks a small lock file next to the data file (e.g.
+ * `Clients.txt.lock`) for the lifetime of the object, so steps such as "snapshot the records, then
+ * rotate the journal" cannot interleave with an append made by another process.
+ *
+ * ## Usage
+ * ```cpp
+ * clsFileLock fileLock(fileName + ".lock");
+ * // ... append to the journal ...
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - POSIX uses `flock()`, Windows uses `LockFileEx()`; both are released by the destructor, and by
+ *   the system if the process dies while holding the lock.
+ * - The lock is not recursive and is tied to the open file, not to the thread: two `clsFileLock`
+ *   objects on the same file exclude each other even inside one process.
+ * - If the lock file cannot be created (e.g. a read-only folder), the object does not lock and
+ *   `isLocked()` returns false; the caller decides whether to go on.
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+class clsFileLock
+{
+private:
+#ifdef _WIN32
+    HANDLE _file = INVALID_HANDLE_VALUE;
+#else
+    int _file = -1;
+#endif
+    bool _locked = false;
+
+public:
+    /**
+     * @brief Locks the given lock file, creating it if needed.
+     *
+     * @param lockFileName The lock file, e.g. the data file name followed by `.lock`.
+     * @param wait When false, gives up at once if another holder has the lock (see `isLocked()`).
+     */
+    explicit clsFileLock(const string& lockFileName, bool wait = true)
+    {
+#ifdef _WIN32
+        _file = CreateFileA(lockFileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE) return;
+
+        OVERLAPPED overlapped = {};
+        _locked = LockFileEx(_file, LOCKFILE_EXCLUSIVE_LOCK | (wait ? 0 : LOCKFILE_FAIL_IMMEDIATELY), 0, 1, 0, &overlapped) != 0;
+#else
+        _file = open(lockFileName.c_str(), O_RDWR | O_CREAT, 0644);
+        if (_file < 0) return;
+
+        _locked = flock(_file, LOCK_EX | (wait ? 0 : LOCK_NB)) == 0;
+#endif
+    }
+
+    ~clsFileLock()
+    {
+#ifdef _WIN32
+        if (_file == INVALID_HANDLE_VALUE) return;
+
+        if (_locked)
+        {
+            OVERLAPPED overlapped = {};
+            UnlockFileEx(_file, 0, 1, 0, &overlapped);
+        }
+        CloseHandle(_file);
+#else
+        if (_file < 0) return;
+
+        if (_locked) flock(_file, LOCK_UN);
+        close(_file);
+#endif
+    }
+
+    /**
+     * @brief Returns whether the lock is held by this object.
+     */
+    bool isLocked() const
+    {
+        return _locked;
+    }
+
+    clsFileLock(const clsFileLock &) = delete;
+    clsFileLock & operator=(const clsFileLock &) = delete;
+};
@@ -0,0 +1,197 @@
+/**
+ * @file clsFixedString.h
+ * @brief Declares the `clsFixedString` class template, a short string stored inline with a fixed capacity.
+ *
+ * ## Overview
+ * Account numbers, PIN codes and user names are short and bounded, yet as `std::string` each one
+ * may live in its own heap block and every comparison chases a pointer. A `clsFixedString<N>`
+ * keeps up to `N` characters inside the object itself, so a client record carries its keys in
+ * the same cache lines as the rest of its data.
+ *
+ * ## Usage
+ * ```cpp
+ * clsFixedString<31> accountNumber("A101");
+ * if (accountNumber == client.getAccountNumber()) ...   // one fixed-size memcmp
+ * cout << setw(17) << accountNumber;                     // prints like a string
+ * string line; line += accountNumber;                    // appends like a string_view
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The unused tail of the buffer is always zero, so two fixed strings of the same capacity are
+ *   equal exactly when their whole objects are byte-equal: `==` is a single fixed-size `memcmp`
+ *   that the compiler turns into a few word compares, with no length branch.
+ * - Text longer than the capacity is never truncated silently: the constructors (and so every
+ *   implicit conversion, e.g. when a record is loaded) throw `length_error`. `assign()` is the one
+ *   explicit way to truncate, and reports it. The input readers
+ *   (`clsInputValidation::readString(maxLength, ...)`) refuse over-long text up front, and the
+ *   record parsers check `fits()` so that a bad line is reported with its content.
+ * - Converts implicitly to `string_view`, and concatenates with `std::string` through `+`;
+ *   use `str()` when a `std::string` is needed.
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+using namespace std;
+
+template <size_t Capacity>
+class clsFixedString
+{
+private:
+    static_assert(Capacity > 0 && Capacity < 256, "the length is stored in one byte");
+
+    // one extra zero byte keeps c_str() valid at full capacity.
+    char _data[Capacity + 1];
+    uint8_t _length;
+
+public:
+    clsFixedString()
+    {
+        memset(this, 0, sizeof(*this));
+    }
+
+    /**
+     * @throws length_error if the text is longer than the capacity.
+     */
+    clsFixedString(string_view text)
+    {
+        if (!assign(text))
+            throw length_error("\"" + string(text) + "\" is longer than " + to_string(Capacity) + " characters");
+    }
+
+    clsFixedString(const string& text) : clsFixedString(string_view(text))
+    {
+    }
+
+    clsFixedString(const char * text) : clsFixedString(string_view(text))
+    {
+    }
+
+    /**
+     * @brief Replaces the content, truncating it to the capacity.
+     * @return false if the text did not fit and was truncated.
+     */
+    bool assign(string_view text)
+    {
+        size_t length = min(text.size(), Capacity);
+
+        memset(this, 0, sizeof(*this));
+        memcpy(_data, text.data(), length);
+        _length = (uint8_t)length;
+
+        return length == text.size();
+    }
+
+    static constexpr size_t capacity()
+    {
+        return Capacity;
+    }
+
+    /**
+     * @return true if the text can be stored without truncation.
+     */
+    static constexpr bool fits(string_view text)
+    {
+        return text.size() <= Capacity;
+    }
+
+    size_t size() const
+    {
+        return _length;
+    }
+
+    bool empty() const
+    {
+        return _length == 0;
+    }
+
+    const char * c_str() const
+    {
+        return _data;
+    }
+
+    string_view view() const
+    {
+        return string_view(_data, _length);
+    }
+
+    operator string_view() const
+    {
+        return view();
+    }
+
+    string str() const
+    {
+        return string(_data, _length);
+    }
+
+    bool operator==(const clsFixedString & other) const
+    {
+        return memcmp(this, &other, sizeof(*this)) == 0;
+    }
+
+    bool operator!=(const clsFixedString & other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator==(string_view text) const
+    {
+        return _length == text.size() && memcmp(_data, text.data(), _length) == 0;
+    }
+
+    bool operator!=(string_view text) const
+    {
+        return !(*this == text);
+    }
+
+    // exact overloads, so that comparing with a string or a literal is not ambiguous.
+    bool operator==(const string& text) const
+    {
+        return *this == string_view(text);
+    }
+
+    bool operator!=(const string& text) const
+    {
+        return !(*this == string_view(text));
+    }
+
+    bool operator==(const char * text) const
+    {
+        return *this == string_view(text);
+    }
+
+    bool operator!=(const char * text) const
+    {
+        return !(*this == string_view(text));
+    }
+
+    bool operator<(const clsFixedString & other) const
+    {
+        return view() < other.view();
+    }
+
+    // builds a string, like concatenating two std::strings (e.g. when serializing a record).
+    friend string operator+(const clsFixedString & text, const string& other)
+    {
+        string result;
+        result.reserve(text.size() + other.size());
+        return result.append(text.view()).append(other);
+    }
+
+    friend string operator+(const string& other, const clsFixedString & text)
+    {
+        string result;
+        result.reserve(other.size() + text.size());
+        return result.append(other).append(text.view());
+    }
+
+    friend ostream & operator<<(ostream & out, const clsFixedString & text)
+    {
+        return out << text.view();
+    }
+};
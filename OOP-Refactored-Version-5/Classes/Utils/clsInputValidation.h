@@ -154,6 +154,18 @@ public:
         return statement;
     }
 
+    static string readString(size_t maxLength, string errorMessage)
+    {
+        string statement = readString();
+
+        while (statement.size() > maxLength)
+        {
+            cout << errorMessage;
+            statement = readString();
+        }
+        return statement;
+    }
+
     static bool isValidDate(clsDate date)
     {
         return date.isDateValidated();
@@ -0,0 +1,419 @@
+/**
+ * @file clsLogScanner.h
+ * @brief Declares the `clsLogScanner` class, a parallel, order-preserving parser of line-based files.
+ *
+ * ## Overview
+ * The transfer and login logs only ever grow, and every list screen re-reads them. Instead of one
+ * `getline` loop, `clsLogScanner` reads the file in large windows, splits every window into byte
+ * ranges that end on line boundaries, and parses the ranges on `clsThreadPool` workers. The parsed
+ * records are handed back **in file order**, either:
+ * - collected into one vector — `readAll()`, or
+ * - streamed to a visitor, one window at a time, so memory stays bounded — `forEach()` (or
+ *   `forEachWithOffsets()`, whose parser also gets the byte offset of every line, and
+ *   `forEachInRange()`, which only scans the lines between two offsets), or
+ * - parsed into arena-aware records that view the file bytes held by a `clsArena` — `readAllViews()`, or
+ * - folded into per-worker partial results that are merged at the end — `aggregate()`.
+ *
+ * Every scan reports its record count, byte count and elapsed time (`stScanStats`).
+ *
+ * ## Usage
+ * ```cpp
+ * clsLogScanner::stScanStats stats;
+ * vector <clsTransferRecord> vTransfers = clsLogScanner::readAll<clsTransferRecord>(TransferLogsFile,
+ *     [](const string& line) { return _convertTransferRecordIntoObject(line); }, &stats);
+ * cout << stats.getRecordsPerSecond() << " records/s";
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The parser is called from several workers at once and must not touch shared state.
+ * - The visitor of `forEach()` always runs on the calling thread.
+ * - The results of `aggregate()` must not depend on the order the partials are merged in: which
+ *   lines a partial sees depends on the thread count.
+ * - Windows are 8 MB; a range is never smaller than 256 KB, so small files are parsed inline.
+ * - Empty lines are skipped, and a trailing `\r` (Windows line ending) is dropped from every line.
+ * - Traces get one span per window and one per range, never one per line: the parsers stay
+ *   untraced, so a large file cannot flood the tracer's ring buffers.
+ * - Likewise `forEachInRange()` (and the scans built on it) records one `logScanner.range` sample
+ *   per call; the parsers are never timed.
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include "clsThreadPool.h"
+#include "clsArena.h"
+#include "clsMetrics.h"
+#include "clsTracer.h"
+using namespace std;
+
+class clsLogScanner
+{
+public:
+    struct stScanStats
+    {
+        size_t records = 0;
+        uintmax_t bytes = 0;
+        double seconds = 0;
+        bool endsWithNewline = true;
+
+        double getRecordsPerSecond() const
+        {
+            return seconds > 0 ? records / seconds : 0;
+        }
+    };
+
+private:
+    static const size_t _windowBytes = 8 * 1024 * 1024;
+    static const size_t _minChunkBytes = 256 * 1024;
+
+    /**
+     * @brief Calls `visit(line)` for every non-empty line between two offsets, `begin` being the start of a line.
+     */
+    template <typename LineVisitor>
+    static void _forEachLine(string_view data, size_t begin, size_t end, LineVisitor visit)
+    {
+        clsTraceSpan span("clsLogScanner::_forEachLine");
+
+        while (begin < end)
+        {
+            size_t lineEnd = data.find('\n', begin);
+            if (lineEnd == string_view::npos || lineEnd > end) lineEnd = end;
+
+            string_view line = data.substr(begin, lineEnd - begin);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+            if (!line.empty())
+                visit(line);
+
+            begin = lineEnd + 1;
+        }
+    }
+
+    /**
+     * @brief Parses the lines of a range with `parse(line, offset)`, `windowOffset` being the file offset of `data`.
+     */
+    template <typename RecordType, typename Parser>
+    static void _parseRange(const string& data, uint64_t windowOffset, size_t begin, size_t end, Parser & parse, vector <RecordType> & vRecords)
+    {
+        string line;
+
+        _forEachLine(data, begin, end, [&](string_view lineView)
+        {
+            line.assign(lineView);
+            vRecords.push_back(parse(line, windowOffset + (lineView.data() - data.data())));
+        });
+    }
+
+    /**
+     * @brief Splits `[0, end)` of `data` into at most `maxChunks` ranges that end on line boundaries.
+     * @return The range bounds: range `i` is `[vBounds[i], vBounds[i + 1])`.
+     */
+    static vector <size_t> _splitIntoRanges(string_view data, size_t end, size_t maxChunks)
+    {
+        size_t chunkCount = min(maxChunks, max<size_t>(1, end / _minChunkBytes));
+
+        vector <size_t> vBounds {0};
+        for (size_t chunk = 1; chunk < chunkCount; chunk++)
+        {
+            size_t lineEnd = data.find('\n', max(vBounds.back(), end * chunk / chunkCount));
+            vBounds.push_back(lineEnd == string_view::npos || lineEnd >= end ? end : lineEnd + 1);
+        }
+        vBounds.push_back(end);
+
+        return vBounds;
+    }
+
+    static size_t _maxChunks(clsThreadPool & pool)
+    {
+        return pool.getThreadCount() * 4;
+    }
+
+    /**
+     * @brief Reads the file window by window and hands every window to `handle`, in file order.
+     *
+     * @param handle `size_t(const string& window, uint64_t windowOffset, const vector <size_t> & vBounds)`, where
+     *        `vBounds` splits the complete lines of the window into ranges (see `_splitIntoRanges()`);
+     *        returns the number of records the window held.
+     * @param startOffset, endOffset The byte range scanned; both must fall on line starts (or the end of the file).
+     */
+    template <typename WindowHandler>
+    static stScanStats _scanWindows(const string& fileName, clsThreadPool & pool, uint64_t startOffset, uint64_t endOffset, WindowHandler handle)
+    {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        stScanStats stats;
+
+        fstream myFile;
+        myFile.open(fileName, ios::in | ios::binary);
+
+        if (!myFile.is_open()) return stats;
+
+        // a log may keep growing while it is scanned: only the records present at the start are read.
+        error_code error;
+        uintmax_t scanEnd = min<uintmax_t>(filesystem::file_size(fileName, error), endOffset);
+
+        if (startOffset > 0) myFile.seekg(startOffset);
+
+        size_t maxChunks = _maxChunks(pool);
+        string window;
+
+        while (true)
+        {
+            uintmax_t position = startOffset + stats.bytes;
+            size_t toRead = (size_t)min<uintmax_t>(_windowBytes, scanEnd > position ? scanEnd - position : 0);
+
+            // the window starts with the unfinished last line of the previous one.
+            size_t carried = window.size();
+            uint64_t windowOffset = position - carried;
+            window.resize(carried + toRead);
+            myFile.read(&window[carried], toRead);
+
+            size_t readBytes = myFile.gcount();
+            bool lastWindow = readBytes < toRead || position + readBytes >= scanEnd;
+
+            window.resize(carried + readBytes);
+            stats.bytes += readBytes;
+            if (!window.empty()) stats.endsWithNewline = (window.back() == '\n');
+
+            // a window without any new line (npos + 1 == 0) is kept whole and extended by the next read.
+            size_t end = lastWindow ? window.size() : window.rfind('\n') + 1;
+
+            if (end != 0)
+            {
+                clsTraceSpan span("clsLogScanner::window");
+                stats.records += handle(window, windowOffset, _splitIntoRanges(window, end, maxChunks));
+                window.erase(0, end);
+            }
+
+            if (lastWindow) break;
+        }
+        myFile.close();
+
+        stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        return stats;
+    }
+
+    /**
+     * @brief Scans the file window by window and hands every parsed range to `consume`, in file order.
+     *
+     * @param parse `RecordType(const string& line, uint64_t offset)`, `offset` being where the line starts in the file.
+     * @param startOffset, endOffset The byte range scanned; both must fall on line starts (or the end of the file).
+     */
+    template <typename RecordType, typename Parser, typename Consumer>
+    static stScanStats _scan(const string& fileName, Parser & parse, Consumer consume, clsThreadPool & pool,
+                             uint64_t startOffset = 0, uint64_t endOffset = UINT64_MAX)
+    {
+        vector <vector <RecordType>> vChunks(_maxChunks(pool));
+
+        return _scanWindows(fileName, pool, startOffset, endOffset, [&](const string& window, uint64_t windowOffset, const vector <size_t> & vBounds)
+        {
+            size_t chunkCount = vBounds.size() - 1, records = 0;
+
+            pool.parallelFor(chunkCount, [&](size_t chunk)
+            {
+                _parseRange(window, windowOffset, vBounds[chunk], vBounds[chunk + 1], parse, vChunks[chunk]);
+            });
+
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+            {
+                records += vChunks[chunk].size();
+                consume(vChunks[chunk]);
+                vChunks[chunk].clear();
+            }
+            return records;
+        });
+    }
+
+public:
+    /**
+     * @brief Parses every line of a file into one vector, in file order.
+     *
+     * @param parse `RecordType(const string& line)`, called concurrently from the pool workers.
+     * @param stats Optional; receives the record count, byte count and elapsed time of the scan.
+     */
+    template <typename RecordType, typename Parser>
+    static vector <RecordType> readAll(const string& fileName, Parser parse, stScanStats * stats = nullptr,
+                                       clsThreadPool & pool = clsThreadPool::shared())
+    {
+        vector <RecordType> vRecords;
+
+        auto parseLine = [&parse](const string& line, uint64_t) { return parse(line); };
+
+        stScanStats scanStats = _scan<RecordType>(fileName, parseLine, [&vRecords](vector <RecordType> & vChunk)
+        {
+            if (vRecords.empty())
+                vRecords.swap(vChunk);
+            else
+                vRecords.insert(vRecords.end(), make_move_iterator(vChunk.begin()), make_move_iterator(vChunk.end()));
+        }, pool);
+
+        if (stats != nullptr) *stats = scanStats;
+        return vRecords;
+    }
+
+    /**
+     * @brief Parses every line of a file and passes the records to `visit`, in file order.
+     *
+     * Only one window of records is held in memory at a time.
+     *
+     * @param parse `RecordType(const string& line)`, called concurrently from the pool workers.
+     * @param visit `void(RecordType & record)`, called on the calling thread.
+     */
+    template <typename RecordType, typename Parser, typename Visitor>
+    static stScanStats forEach(const string& fileName, Parser parse, Visitor visit, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        return forEachWithOffsets<RecordType>(fileName, [&parse](const string& line, uint64_t) { return parse(line); }, visit, pool);
+    }
+
+    /**
+     * @brief Like `forEach()`, but the parser also receives the byte offset of the line in the file.
+     *
+     * @param parse `RecordType(const string& line, uint64_t offset)`, called concurrently from the pool workers.
+     * @param visit `void(RecordType & record)`, called on the calling thread.
+     */
+    template <typename RecordType, typename Parser, typename Visitor>
+    static stScanStats forEachWithOffsets(const string& fileName, Parser parse, Visitor visit, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        return forEachInRange<RecordType>(fileName, 0, UINT64_MAX, parse, visit, pool);
+    }
+
+    /**
+     * @brief Like `forEachWithOffsets()`, but only for the lines in `[startOffset, endOffset)`.
+     *
+     * Both offsets must be line starts (an offset past the end of the file stands for the end),
+     * e.g. offsets handed to the parser by an earlier scan.
+     */
+    template <typename RecordType, typename Parser, typename Visitor>
+    static stScanStats forEachInRange(const string& fileName, uint64_t startOffset, uint64_t endOffset, Parser parse, Visitor visit,
+                                      clsThreadPool & pool = clsThreadPool::shared())
+    {
+        static clsMetrics::clsHistogram & rangeLatency = clsMetrics::histogram("logScanner.range");
+        clsMetrics::clsScopedTimer timer(rangeLatency);
+
+        return _scan<RecordType>(fileName, parse, [&visit](vector <RecordType> & vChunk)
+        {
+            for (RecordType & record : vChunk)
+                visit(record);
+        }, pool, startOffset, endOffset);
+    }
+
+    /**
+     * @brief Folds every line of a file into partial results on the pool workers, then merges them.
+     *
+     * Nothing is collected: every range of every window is folded into the partial of its range
+     * slot (one per slot, kept across windows), and the partials are merged into one at the end.
+     *
+     * @param accumulate `void(Partial & partial, string_view line, uint64_t offset)`, called concurrently
+     *        from the pool workers, each on its own partial.
+     * @param merge `void(Partial & total, Partial & partial)`, called on the calling thread.
+     * @return The merged result; `stats` (optional) receives the line count, byte count and elapsed time.
+     */
+    template <typename Partial, typename Accumulator, typename Merger>
+    static Partial aggregate(const string& fileName, Accumulator accumulate, Merger merge, stScanStats * stats = nullptr,
+                             clsThreadPool & pool = clsThreadPool::shared())
+    {
+        vector <Partial> vPartials(_maxChunks(pool));
+        vector <size_t> vLineCounts(vPartials.size());
+
+        stScanStats scanStats = _scanWindows(fileName, pool, 0, UINT64_MAX, [&](const string& window, uint64_t windowOffset, const vector <size_t> & vBounds)
+        {
+            size_t chunkCount = vBounds.size() - 1, records = 0;
+
+            pool.parallelFor(chunkCount, [&](size_t chunk)
+            {
+                Partial & partial = vPartials[chunk];
+                size_t lines = 0;
+
+                _forEachLine(window, vBounds[chunk], vBounds[chunk + 1], [&](string_view line)
+                {
+                    accumulate(partial, line, windowOffset + (line.data() - window.data()));
+                    lines++;
+                });
+                vLineCounts[chunk] = lines;
+            });
+
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+                records += vLineCounts[chunk];
+            return records;
+        });
+
+        Partial total = move(vPartials[0]);
+        for (size_t slot = 1; slot < vPartials.size(); slot++)
+            merge(total, vPartials[slot]);
+
+        if (stats != nullptr) *stats = scanStats;
+        return total;
+    }
+
+    /**
+     * @brief Reads a whole file into an arena and parses every line into an arena-aware record, in file order.
+     *
+     * Runs in two parallel passes over newline-aligned ranges: the lines of every range are counted,
+     * then every range parses its lines straight into their final slots. The file bytes, the records
+     * (which view those bytes) and the array holding them all come from `arena`.
+     *
+     * @param parse `ViewType(string_view line)`, called concurrently from the pool workers.
+     * @param stats Optional; receives the record count, byte count and elapsed time of the scan.
+     */
+    template <typename ViewType, typename Parser>
+    static clsArenaVector <ViewType> readAllViews(const string& fileName, clsArena & arena, Parser parse,
+                                                  stScanStats * stats = nullptr, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        clsArenaVector <ViewType> vRecords {clsArenaAllocator<ViewType>(arena)};
+        stScanStats scanStats;
+
+        fstream myFile;
+        myFile.open(fileName, ios::in | ios::binary);
+
+        if (myFile.is_open())
+        {
+            error_code error;
+            size_t fileSize = (size_t)filesystem::file_size(fileName, error);
+
+            char * buffer = arena.allocateArray<char>(fileSize);
+            myFile.read(buffer, fileSize);
+
+            string_view data(buffer, myFile.gcount());
+            myFile.close();
+
+            scanStats.bytes = data.size();
+            scanStats.endsWithNewline = data.empty() || data.back() == '\n';
+
+            vector <size_t> vBounds = _splitIntoRanges(data, data.size(), pool.getThreadCount() * 4);
+            size_t chunkCount = vBounds.size() - 1;
+
+            // 1. count the records of every range, to know where each range starts in the output.
+            vector <size_t> vFirstRecord(chunkCount + 1, 0);
+
+            pool.parallelFor(chunkCount, [&](size_t chunk)
+            {
+                _forEachLine(data, vBounds[chunk], vBounds[chunk + 1], [&](string_view) { vFirstRecord[chunk + 1]++; });
+            });
+
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+                vFirstRecord[chunk + 1] += vFirstRecord[chunk];
+
+            // 2. parse every range into its slots.
+            vRecords.resize(vFirstRecord[chunkCount]);
+
+            pool.parallelFor(chunkCount, [&](size_t chunk)
+            {
+                size_t position = vFirstRecord[chunk];
+                _forEachLine(data, vBounds[chunk], vBounds[chunk + 1], [&](string_view line) { vRecords[position++] = parse(line); });
+            });
+
+            scanStats.records = vRecords.size();
+        }
+
+        scanStats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (stats != nullptr) *stats = scanStats;
+        return vRecords;
+    }
+};
@@ -0,0 +1,127 @@
+/**
+ * @file clsLoserTree.h
+ * @brief Declares the `clsLoserTree` class, the tournament tree picking the next record of a k-way merge.
+ *
+ * ## Overview
+ * A k-way merge repeatedly needs "which of the k sources holds the smallest current record?".
+ * A loser tree answers it with one comparison per tree level: every internal node remembers the
+ * source that **lost** the match played there, and the overall winner sits at the root. Once the
+ * winner's source has moved to its next record, only the matches on the path from that source to
+ * the root are replayed (`log2(k)` comparisons, against a binary heap's `2 log2(k)`).
+ *
+ * ## Usage
+ * ```cpp
+ * clsLoserTree tree(vRuns.size(), [&](size_t a, size_t b) { return vRuns[a].key < vRuns[b].key; });
+ * tree.build();
+ * while (!tree.empty())
+ * {
+ *     size_t run = tree.winner();
+ *     output(vRuns[run].line);
+ *     if (!vRuns[run].next()) tree.markExhausted(run);
+ *     tree.replay(run);
+ * }
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - The tree only holds source numbers; the records stay with their sources and are compared
+ *   through the caller's `before(a, b)`.
+ * - An exhausted source loses every match, so the merge ends when the winner is exhausted.
+ * - Equal records are won by the lower source number: merging runs written in input order is stable.
+ * - Any `k` works (not only powers of two): the leaves `k .. 2k-1` hang under a complete binary tree.
+ */
+#pragma once
+#include <iostream>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+template <typename Before>
+class clsLoserTree
+{
+private:
+    size_t _k;
+    Before _before;
+    vector <size_t> _vLosers;      // _vLosers[0] is the winner, _vLosers[1 .. k-1] the losers of every match.
+    vector <char> _vExhausted;
+
+    bool _beats(size_t a, size_t b) const
+    {
+        if (_vExhausted[a]) return false;
+        if (_vExhausted[b]) return true;
+
+        if (_before(a, b)) return true;
+        if (_before(b, a)) return false;
+        return a < b;
+    }
+
+public:
+    /**
+     * @param k The number of sources.
+     * @param before `bool(size_t a, size_t b)`: whether the current record of source `a` comes before the one of `b`.
+     */
+    clsLoserTree(size_t k, Before before)
+        : _k(max<size_t>(1, k)), _before(before), _vLosers(_k, 0), _vExhausted(_k, 0)
+    {
+        // a zero-source tree is one exhausted source.
+        if (k == 0) _vExhausted[0] = 1;
+    }
+
+    /**
+     * @brief Plays every match; call once every source is on its first record (or marked exhausted).
+     */
+    void build()
+    {
+        // vWinners[node] is the winner of the sub-tree under `node`; the leaves are the sources.
+        vector <size_t> vWinners(2 * _k);
+        for (size_t source = 0; source < _k; source++)
+            vWinners[_k + source] = source;
+
+        for (size_t node = _k - 1; node >= 1; node--)
+        {
+            size_t left = vWinners[2 * node], right = vWinners[2 * node + 1];
+            bool leftWins = _beats(left, right);
+
+            vWinners[node] = leftWins ? left : right;
+            _vLosers[node] = leftWins ? right : left;
+        }
+
+        _vLosers[0] = _k == 1 ? 0 : vWinners[1];
+    }
+
+    /**
+     * @brief Returns the source holding the smallest current record.
+     */
+    size_t winner() const
+    {
+        return _vLosers[0];
+    }
+
+    /**
+     * @brief Returns whether every source is exhausted.
+     */
+    bool empty() const
+    {
+        return _vExhausted[_vLosers[0]] != 0;
+    }
+
+    void markExhausted(size_t source)
+    {
+        _vExhausted[source] = 1;
+    }
+
+    /**
+     * @brief Replays the matches of the winner after its source moved to its next record (or was exhausted).
+     */
+    void replay(size_t source)
+    {
+        size_t winner = source;
+
+        for (size_t node = (source + _k) / 2; node >= 1; node /= 2)
+        {
+            if (_beats(_vLosers[node], winner))
+                swap(_vLosers[node], winner);
+        }
+
+        _vLosers[0] = winner;
+    }
+};
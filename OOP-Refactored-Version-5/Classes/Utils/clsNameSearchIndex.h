@@ -0,0 +1,361 @@
+/**
+ * @file clsNameSearchIndex.h
+ * @brief Declares the `clsNameSearchIndex` class, a ranked name search over a trigram index and a sorted prefix index.
+ *
+ * ## Overview
+ * Every document is an id (e.g. an account number) with a first and a last name. Names are
+ * normalized (lower case, single spaces) and indexed twice:
+ * - a **sorted prefix index** of the tokens `first`, `last` and `first last`, answering
+ *   "starts with" queries with one binary search;
+ * - a **trigram index** mapping every 3-character slice of `first last` to the documents that
+ *   contain it, answering "contains" queries by verifying only the documents of the query's
+ *   rarest trigrams.
+ *
+ * ## Ranking
+ * | Score | Match                                       |
+ * |-------|---------------------------------------------|
+ * | 4     | the whole name equals the query             |
+ * | 3     | the first or the last name equals the query |
+ * | 2     | a name starts with the query                |
+ * | 1     | the name contains the query                 |
+ *
+ * Ties are broken by the shorter name, then alphabetically, then by id.
+ *
+ * ## Usage
+ * ```cpp
+ * clsNameSearchIndex index;
+ * index.add("A101", "Andrew", "Remon");
+ * vector <stNameMatch> vMatches = index.search("rem", 20);   // A101, score 2
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - Maintained incrementally: `add()`, `update()` and `remove()` never rebuild the index.
+ *   A removed or renamed document is only tombstoned; its postings are skipped by searches and
+ *   dropped when the tombstones outnumber the live documents (`_compact()`).
+ * - New prefix tokens go to a small unsorted list that is sorted and merged into the main list
+ *   once it reaches 1/8 of it, so building N documents stays O(N log N).
+ * - Posting lists hold document numbers in ascending order (documents are only ever appended),
+ *   so the query trigrams are intersected with binary searches.
+ * - A query matching a huge number of prefixes (e.g. one letter) collects at most
+ *   `_maxCandidates` of them before ranking.
+ * - Not thread-safe: one index belongs to one thread (the screens).
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cctype>
+using namespace std;
+
+/**
+ * @struct stNameMatch
+ * @brief One search result: the document id, its normalized name and its score (see the ranking table).
+ */
+struct stNameMatch
+{
+    string id;
+    string name;
+    int score = 0;
+};
+
+class clsNameSearchIndex
+{
+private:
+    static const size_t _maxCandidates = 10000;
+    static const size_t _minPendingMerge = 4096;
+    static const size_t _minDeadCompact = 1024;
+
+    struct stDocument
+    {
+        string id;
+        string name;           // normalized "first last"
+        size_t firstLength = 0;
+        bool alive = true;
+    };
+
+    struct stPrefix
+    {
+        string token;
+        uint32_t document;
+
+        bool operator<(const stPrefix & other) const
+        {
+            return token < other.token || (token == other.token && document < other.document);
+        }
+    };
+
+    vector <stDocument> _vDocuments;
+    unordered_map <string, uint32_t> _mpDocumentOfId;
+    unordered_map <uint32_t, vector <uint32_t>> _mpPostings;
+    vector <stPrefix> _vPrefixes, _vPendingPrefixes;
+    size_t _deadDocuments = 0;
+
+    static uint32_t _trigramAt(const string& text, size_t position)
+    {
+        return (uint32_t(uint8_t(text[position])) << 16) | (uint32_t(uint8_t(text[position + 1])) << 8) | uint8_t(text[position + 2]);
+    }
+
+    static vector <uint32_t> _distinctTrigrams(const string& text)
+    {
+        vector <uint32_t> vTrigrams;
+
+        for (size_t i = 0; i + 3 <= text.size(); i++)
+            vTrigrams.push_back(_trigramAt(text, i));
+
+        sort(vTrigrams.begin(), vTrigrams.end());
+        vTrigrams.erase(unique(vTrigrams.begin(), vTrigrams.end()), vTrigrams.end());
+        return vTrigrams;
+    }
+
+    void _mergePendingPrefixes()
+    {
+        size_t sortedCount = _vPrefixes.size();
+
+        sort(_vPendingPrefixes.begin(), _vPendingPrefixes.end());
+        _vPrefixes.insert(_vPrefixes.end(), make_move_iterator(_vPendingPrefixes.begin()), make_move_iterator(_vPendingPrefixes.end()));
+        inplace_merge(_vPrefixes.begin(), _vPrefixes.begin() + sortedCount, _vPrefixes.end());
+
+        _vPendingPrefixes.clear();
+    }
+
+    void _addPrefix(string token, uint32_t document)
+    {
+        if (token.empty()) return;
+
+        _vPendingPrefixes.push_back({move(token), document});
+
+        if (_vPendingPrefixes.size() >= max(_minPendingMerge, _vPrefixes.size() / 8))
+            _mergePendingPrefixes();
+    }
+
+    /**
+     * @brief Rebuilds the index from its live documents, dropping every tombstone.
+     */
+    void _compact()
+    {
+        vector <stDocument> vLiveDocuments;
+        vLiveDocuments.reserve(_vDocuments.size() - _deadDocuments);
+
+        for (stDocument & document : _vDocuments)
+        {
+            if (document.alive)
+                vLiveDocuments.push_back(move(document));
+        }
+
+        clear();
+        for (stDocument & document : vLiveDocuments)
+            add(document.id, string_view(document.name).substr(0, document.firstLength),
+                document.firstLength < document.name.size() ? string_view(document.name).substr(document.firstLength + 1) : string_view());
+    }
+
+    int _scoreOf(const stDocument & document, const string& query) const
+    {
+        string_view name(document.name);
+        string_view firstName = name.substr(0, document.firstLength);
+        string_view lastName = document.firstLength < name.size() ? name.substr(document.firstLength + 1) : string_view();
+
+        if (name == query) return 4;
+        if (firstName == query || lastName == query) return 3;
+        if (name.substr(0, query.size()) == query || lastName.substr(0, query.size()) == query) return 2;
+        return name.find(query) != string_view::npos ? 1 : 0;
+    }
+
+    void _collectPrefixMatches(const vector <stPrefix> & vPrefixes, bool sorted, const string& query,
+                               unordered_map <uint32_t, int> & mpScores) const
+    {
+        if (!sorted)
+        {
+            for (const stPrefix & prefix : vPrefixes)
+            {
+                if (mpScores.size() >= _maxCandidates) return;
+                if (prefix.token.compare(0, query.size(), query) == 0 && _vDocuments[prefix.document].alive)
+                    mpScores[prefix.document] = _scoreOf(_vDocuments[prefix.document], query);
+            }
+            return;
+        }
+
+        auto it = lower_bound(vPrefixes.begin(), vPrefixes.end(), stPrefix{query, 0});
+
+        for (; it != vPrefixes.end() && it->token.compare(0, query.size(), query) == 0; ++it)
+        {
+            if (mpScores.size() >= _maxCandidates) return;
+            if (_vDocuments[it->document].alive)
+                mpScores[it->document] = _scoreOf(_vDocuments[it->document], query);
+        }
+    }
+
+    void _collectSubstringMatches(const string& query, unordered_map <uint32_t, int> & mpScores) const
+    {
+        vector <const vector <uint32_t> *> vLists;
+
+        for (uint32_t trigram : _distinctTrigrams(query))
+        {
+            auto it = _mpPostings.find(trigram);
+            if (it == _mpPostings.end()) return;
+            vLists.push_back(&it->second);
+        }
+
+        sort(vLists.begin(), vLists.end(), [](const vector <uint32_t> * a, const vector <uint32_t> * b) { return a->size() < b->size(); });
+
+        for (uint32_t document : *vLists[0])
+        {
+            if (mpScores.size() >= _maxCandidates) return;
+            if (!_vDocuments[document].alive || mpScores.count(document) != 0) continue;
+
+            bool inAllLists = true;
+            for (size_t i = 1; i < vLists.size() && inAllLists; i++)
+                inAllLists = binary_search(vLists[i]->begin(), vLists[i]->end(), document);
+
+            // the trigrams may be scattered over the name: confirm the whole query.
+            if (inAllLists && _vDocuments[document].name.find(query) != string::npos)
+                mpScores[document] = _scoreOf(_vDocuments[document], query);
+        }
+    }
+
+public:
+    /**
+     * @brief Lower-cases a name and collapses its blanks into single spaces.
+     */
+    static string normalize(string_view text)
+    {
+        string normalized;
+        normalized.reserve(text.size());
+
+        for (char character : text)
+        {
+            if (isspace((unsigned char)character))
+            {
+                if (!normalized.empty() && normalized.back() != ' ')
+                    normalized += ' ';
+            }
+            else
+                normalized += (char)tolower((unsigned char)character);
+        }
+
+        if (!normalized.empty() && normalized.back() == ' ')
+            normalized.pop_back();
+        return normalized;
+    }
+
+    void clear()
+    {
+        _vDocuments.clear();
+        _mpDocumentOfId.clear();
+        _mpPostings.clear();
+        _vPrefixes.clear();
+        _vPendingPrefixes.clear();
+        _deadDocuments = 0;
+    }
+
+    /**
+     * @brief Indexes a document; an id that is already indexed is replaced.
+     */
+    void add(const string& id, string_view firstName, string_view lastName)
+    {
+        remove(id);
+
+        stDocument document;
+        string first = normalize(firstName), last = normalize(lastName);
+
+        document.id = id;
+        document.firstLength = first.size();
+        document.name = last.empty() ? first : first + " " + last;
+
+        uint32_t number = (uint32_t)_vDocuments.size();
+
+        for (uint32_t trigram : _distinctTrigrams(document.name))
+            _mpPostings[trigram].push_back(number);
+
+        if (!last.empty()) _addPrefix(document.name, number);
+        _addPrefix(move(first), number);
+        _addPrefix(move(last), number);
+
+        _mpDocumentOfId[id] = number;
+        _vDocuments.push_back(move(document));
+    }
+
+    /**
+     * @brief Re-indexes a document whose name may have changed; does nothing if the name is the same.
+     */
+    void update(const string& id, string_view firstName, string_view lastName)
+    {
+        auto it = _mpDocumentOfId.find(id);
+
+        if (it != _mpDocumentOfId.end())
+        {
+            const stDocument & document = _vDocuments[it->second];
+            string first = normalize(firstName), last = normalize(lastName);
+
+            if (document.firstLength == first.size() && document.name == (last.empty() ? first : first + " " + last))
+                return;
+        }
+        add(id, firstName, lastName);
+    }
+
+    /**
+     * @brief Removes a document, if it is indexed.
+     */
+    void remove(const string& id)
+    {
+        auto it = _mpDocumentOfId.find(id);
+        if (it == _mpDocumentOfId.end()) return;
+
+        _vDocuments[it->second].alive = false;
+        _mpDocumentOfId.erase(it);
+        _deadDocuments++;
+
+        if (_deadDocuments >= _minDeadCompact && _deadDocuments > _vDocuments.size() / 2)
+            _compact();
+    }
+
+    size_t size() const
+    {
+        return _mpDocumentOfId.size();
+    }
+
+    /**
+     * @brief Finds the documents whose name starts with or contains the query, best matches first.
+     *
+     * @param query Any part of a name; case and extra blanks are ignored.
+     * @param maxResults The number of matches to return at most.
+     */
+    vector <stNameMatch> search(string_view query, size_t maxResults) const
+    {
+        string normalized = normalize(query);
+        vector <stNameMatch> vMatches;
+
+        if (normalized.empty()) return vMatches;
+
+        unordered_map <uint32_t, int> mpScores;
+
+        _collectPrefixMatches(_vPrefixes, true, normalized, mpScores);
+        _collectPrefixMatches(_vPendingPrefixes, false, normalized, mpScores);
+
+        if (normalized.size() >= 3)
+            _collectSubstringMatches(normalized, mpScores);
+
+        vector <pair <uint32_t, int>> vRanked(mpScores.begin(), mpScores.end());
+
+        auto isBetter = [this](const pair <uint32_t, int> & a, const pair <uint32_t, int> & b)
+        {
+            const stDocument & documentA = _vDocuments[a.first];
+            const stDocument & documentB = _vDocuments[b.first];
+
+            if (a.second != b.second) return a.second > b.second;
+            if (documentA.name.size() != documentB.name.size()) return documentA.name.size() < documentB.name.size();
+            if (documentA.name != documentB.name) return documentA.name < documentB.name;
+            return documentA.id < documentB.id;
+        };
+
+        size_t count = min(maxResults, vRanked.size());
+        partial_sort(vRanked.begin(), vRanked.begin() + count, vRanked.end(), isBetter);
+
+        for (size_t i = 0; i < count; i++)
+            vMatches.push_back({_vDocuments[vRanked[i].first].id, _vDocuments[vRanked[i].first].name, vRanked[i].second});
+        return vMatches;
+    }
+};
@@ -0,0 +1,174 @@
+/**
+ * @file clsParallelOrder.h
+ * @brief Declares the `clsParallelOrder` class, which orders records by index without moving them.
+ *
+ * ## Overview
+ * Sorting a list screen's records would move whole records around. `clsParallelOrder` works on
+ * record *numbers* instead: the caller passes a comparator over two record numbers, and gets back
+ * a permutation (the record numbers in order), which the screen prints through.
+ *
+ * - `sortedPermutation()` sorts every chunk of the numbers on its own worker, then merges the
+ *   chunks pairwise, level by level (every level's merges also run in parallel).
+ * - `topK()` keeps the best `k` record numbers of every chunk in a bounded heap (one pass, O(n log k)),
+ *   then merges the per-chunk winners and ranks them: the "top 100" of millions of records never
+ *   sorts them all.
+ *
+ * ## Usage
+ * ```cpp
+ * vector <uint32_t> vOrder = clsParallelOrder::sortedPermutation(vClients.size(),
+ *     [&](uint32_t a, uint32_t b) { return vClients[a].lastName < vClients[b].lastName; });
+ * vector <uint32_t> vRichest = clsParallelOrder::topK(vClients.size(), 100,
+ *     [&](uint32_t a, uint32_t b) { return vClients[a].accountBalance > vClients[b].accountBalance; });
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - Records that compare equal keep their original order (ties are broken by record number),
+ *   so the result does not depend on the number of threads.
+ * - Inputs under `_minParallelCount` records are ordered on the calling thread.
+ * - The comparator is called from several workers at once: it must only read the records.
+ */
+#pragma once
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include "clsThreadPool.h"
+using namespace std;
+
+class clsParallelOrder
+{
+private:
+    static const size_t _minParallelCount = 32 * 1024;
+
+    static size_t _chunkCount(size_t count, clsThreadPool & pool)
+    {
+        if (count < _minParallelCount) return 1;
+        return min(pool.getThreadCount() * 2, count / (_minParallelCount / 2));
+    }
+
+    /**
+     * @brief Wraps a comparator so that equal records are ordered by record number.
+     */
+    template <typename Before>
+    static auto _strict(const Before & before)
+    {
+        return [&before](uint32_t a, uint32_t b)
+        {
+            if (before(a, b)) return true;
+            if (before(b, a)) return false;
+            return a < b;
+        };
+    }
+
+public:
+    /**
+     * @brief Returns the record numbers `[0, count)` ordered by `before`.
+     *
+     * @param before `before(a, b)` is true when record `a` must come before record `b`.
+     */
+    template <typename Before>
+    static vector <uint32_t> sortedPermutation(size_t count, const Before & before, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        auto strictBefore = _strict(before);
+
+        vector <uint32_t> vOrder(count);
+        iota(vOrder.begin(), vOrder.end(), 0);
+
+        size_t chunkCount = _chunkCount(count, pool);
+        if (chunkCount <= 1)
+        {
+            sort(vOrder.begin(), vOrder.end(), strictBefore);
+            return vOrder;
+        }
+
+        // 1. sort every chunk.
+        vector <size_t> vBounds(chunkCount + 1);
+        for (size_t chunk = 0; chunk <= chunkCount; chunk++)
+            vBounds[chunk] = count * chunk / chunkCount;
+
+        pool.parallelFor(chunkCount, [&](size_t chunk)
+        {
+            sort(vOrder.begin() + vBounds[chunk], vOrder.begin() + vBounds[chunk + 1], strictBefore);
+        });
+
+        // 2. merge neighbouring runs until one is left.
+        vector <uint32_t> vMerged(count);
+
+        while (vBounds.size() > 2)
+        {
+            size_t runCount = vBounds.size() - 1;
+            size_t pairCount = (runCount + 1) / 2;
+
+            pool.parallelFor(pairCount, [&](size_t pair)
+            {
+                size_t begin = vBounds[pair * 2];
+                size_t middle = vBounds[min(pair * 2 + 1, runCount)];
+                size_t end = vBounds[min(pair * 2 + 2, runCount)];
+
+                merge(vOrder.begin() + begin, vOrder.begin() + middle, vOrder.begin() + middle, vOrder.begin() + end,
+                      vMerged.begin() + begin, strictBefore);
+            });
+
+            vector <size_t> vNextBounds;
+            for (size_t i = 0; i < vBounds.size(); i += 2)
+                vNextBounds.push_back(vBounds[i]);
+            if (vNextBounds.back() != count)
+                vNextBounds.push_back(count);
+
+            vOrder.swap(vMerged);
+            vBounds.swap(vNextBounds);
+        }
+        return vOrder;
+    }
+
+    /**
+     * @brief Returns the `k` first record numbers by `before`, in order, without sorting the others.
+     *
+     * @param before `before(a, b)` is true when record `a` ranks above record `b`.
+     */
+    template <typename Before>
+    static vector <uint32_t> topK(size_t count, size_t k, const Before & before, clsThreadPool & pool = clsThreadPool::shared())
+    {
+        auto strictBefore = _strict(before);
+
+        k = min(k, count);
+        if (k == 0) return vector <uint32_t>();
+
+        size_t chunkCount = _chunkCount(count, pool);
+        vector <vector <uint32_t>> vChunkWinners(chunkCount);
+
+        // 1. one pass per chunk; the heap's front is the weakest of the k kept so far.
+        pool.parallelFor(chunkCount, [&](size_t chunk)
+        {
+            vector <uint32_t> & vHeap = vChunkWinners[chunk];
+            vHeap.reserve(k);
+
+            size_t begin = count * chunk / chunkCount, end = count * (chunk + 1) / chunkCount;
+
+            for (size_t record = begin; record < end; record++)
+            {
+                if (vHeap.size() < k)
+                {
+                    vHeap.push_back((uint32_t)record);
+                    push_heap(vHeap.begin(), vHeap.end(), strictBefore);
+                }
+                else if (strictBefore((uint32_t)record, vHeap.front()))
+                {
+                    pop_heap(vHeap.begin(), vHeap.end(), strictBefore);
+                    vHeap.back() = (uint32_t)record;
+                    push_heap(vHeap.begin(), vHeap.end(), strictBefore);
+                }
+            }
+        });
+
+        // 2. the overall top k is among the chunks' winners.
+        vector <uint32_t> vCandidates;
+        for (const vector <uint32_t> & vWinners : vChunkWinners)
+            vCandidates.insert(vCandidates.end(), vWinners.begin(), vWinners.end());
+
+        partial_sort(vCandidates.begin(), vCandidates.begin() + k, vCandidates.end(), strictBefore);
+        vCandidates.resize(k);
+        return vCandidates;
+    }
+};
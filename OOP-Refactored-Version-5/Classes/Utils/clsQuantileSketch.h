@@ -0,0 +1,163 @@
+/**
+ * @file clsQuantileSketch.h
+ * @brief Declares the `clsQuantileSketch` class, a small mergeable summary answering approximate quantiles.
+ *
+ * ## Overview
+ * Exact quantiles need every value at hand. A quantile sketch keeps a few thousand of them
+ * instead, each standing for a power-of-two number of the values it replaced, and still answers
+ * "what is the median / the 99th percentile?" within about 1% of the rank. Two sketches built on
+ * different parts of the data **merge** into the sketch of the whole, so every worker of a
+ * parallel scan builds its own and the results are merged at the end.
+ *
+ * ## Usage
+ * ```cpp
+ * clsQuantileSketch first, second;
+ * first.add(120.5);
+ * second.add(3000);
+ * first.merge(second);
+ * first.quantile(0.5);   // the approximate median of both
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - Compactor levels in the style of the KLL sketch: level `L` holds values of weight `2^L`.
+ *   A level reaching `k` values is sorted and every other value (starting at a pseudo-random
+ *   0 or 1) is promoted to the next level; an odd value out stays behind, so no weight is lost.
+ * - Memory is about `k * log2(n / k)` values; the default `k` of 256 keeps the rank error near 1%.
+ * - The coin flips come from a fixed-seed xorshift, so the same input always gives the same sketch.
+ * - The minimum and the maximum are tracked exactly: `quantile(0)` and `quantile(1)` are exact.
+ * - Not thread-safe: one sketch per worker, merged afterwards.
+ */
+#pragma once
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+using namespace std;
+
+class clsQuantileSketch
+{
+private:
+    size_t _k;
+    vector <vector <double>> _vLevels;
+    uint64_t _count = 0;
+    uint32_t _randomState = 0x9E3779B9u;
+    double _min = 0, _max = 0;
+
+    uint32_t _nextBit()
+    {
+        _randomState ^= _randomState << 13;
+        _randomState ^= _randomState >> 17;
+        _randomState ^= _randomState << 5;
+        return _randomState & 1;
+    }
+
+    void _compact(size_t level)
+    {
+        if (_vLevels.size() == level + 1)
+            _vLevels.emplace_back();
+
+        vector <double> & vValues = _vLevels[level];
+        sort(vValues.begin(), vValues.end());
+
+        // an odd value out keeps its weight at this level.
+        size_t pairedCount = vValues.size() & ~size_t(1);
+        double leftover = vValues.back();
+
+        vector <double> & vPromoted = _vLevels[level + 1];
+        for (size_t i = _nextBit(); i < pairedCount; i += 2)
+            vPromoted.push_back(vValues[i]);
+
+        bool hasLeftover = pairedCount < vValues.size();
+        vValues.clear();
+        if (hasLeftover) vValues.push_back(leftover);
+
+        if (_vLevels[level + 1].size() >= _k)
+            _compact(level + 1);
+    }
+
+public:
+    explicit clsQuantileSketch(size_t k = 256)
+        : _k(max<size_t>(k, 8)), _vLevels(1)
+    {
+    }
+
+    void add(double value)
+    {
+        _min = _count == 0 ? value : min(_min, value);
+        _max = _count == 0 ? value : max(_max, value);
+        _count++;
+
+        _vLevels[0].push_back(value);
+        if (_vLevels[0].size() >= _k)
+            _compact(0);
+    }
+
+    /**
+     * @brief Folds another sketch (built on other values) into this one.
+     */
+    void merge(const clsQuantileSketch & other)
+    {
+        if (other._count == 0) return;
+
+        _min = _count == 0 ? other._min : min(_min, other._min);
+        _max = _count == 0 ? other._max : max(_max, other._max);
+        _count += other._count;
+
+        if (_vLevels.size() < other._vLevels.size())
+            _vLevels.resize(other._vLevels.size());
+
+        for (size_t level = 0; level < other._vLevels.size(); level++)
+            _vLevels[level].insert(_vLevels[level].end(), other._vLevels[level].begin(), other._vLevels[level].end());
+
+        for (size_t level = 0; level < _vLevels.size(); level++)
+        {
+            if (_vLevels[level].size() >= _k)
+                _compact(level);
+        }
+    }
+
+    uint64_t getCount() const
+    {
+        return _count;
+    }
+
+    /**
+     * @brief The number of values the sketch keeps (its memory footprint, in values).
+     */
+    size_t getRetainedCount() const
+    {
+        size_t retained = 0;
+        for (const vector <double> & vValues : _vLevels)
+            retained += vValues.size();
+        return retained;
+    }
+
+    /**
+     * @brief Returns the approximate `q`-quantile (nearest rank), `q` in [0, 1]; 0 for an empty sketch.
+     */
+    double quantile(double q) const
+    {
+        if (_count == 0) return 0;
+        if (q <= 0) return _min;
+        if (q >= 1) return _max;
+
+        vector <pair <double, uint64_t>> vWeighted;
+        for (size_t level = 0; level < _vLevels.size(); level++)
+        {
+            for (double value : _vLevels[level])
+                vWeighted.push_back({value, uint64_t(1) << level});
+        }
+        sort(vWeighted.begin(), vWeighted.end());
+
+        uint64_t targetRank = (uint64_t)ceil(q * _count);
+        uint64_t cumulativeWeight = 0;
+
+        for (const pair <double, uint64_t> & weighted : vWeighted)
+        {
+            cumulativeWeight += weighted.second;
+            if (cumulativeWeight >= targetRank) return weighted.first;
+        }
+        return _max;
+    }
+};
@@ -0,0 +1,268 @@
+/**
+ * @file clsRadixTree.h
+ * @brief Declares the `clsRadixTree` class, a compressed prefix tree of strings with prefix enumeration.
+ *
+ * ## Overview
+ * A radix tree stores a set of strings as a tree whose edges carry whole substrings: a chain of
+ * nodes with a single child is merged into one node. Account numbers share long prefixes
+ * (`A100001`, `A100002` ...), so the tree stays small, and listing the keys that start with a
+ * prefix costs one walk down the prefix plus the keys listed.
+ *
+ * ## Usage
+ * ```cpp
+ * clsRadixTree tree;
+ * tree.insert("A101");
+ * tree.insert("A102");
+ * tree.withPrefix("A10", 10);     // {"A101", "A102"}, in lexicographic order
+ * tree.countWithPrefix("A10");    // 2
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - Every node counts the keys of its subtree, so `countWithPrefix()` is O(prefix length) and an
+ *   enumeration can report "N more" without visiting them.
+ * - Children are kept sorted by the first character of their label (siblings never share it),
+ *   so a depth-first walk lists keys in lexicographic order and finding a child is a binary search.
+ * - `erase()` removes emptied nodes and merges a node left with a single child into it, so the
+ *   tree stays compressed under deletes.
+ * - Not thread-safe.
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <algorithm>
+using namespace std;
+
+class clsRadixTree
+{
+private:
+    struct stNode
+    {
+        string label;
+        bool isKey = false;
+        size_t keyCount = 0;
+        vector <unique_ptr<stNode>> vChildren;
+    };
+
+    stNode _root;
+
+    static vector <unique_ptr<stNode>>::iterator _lowerBound(stNode & node, char first)
+    {
+        return lower_bound(node.vChildren.begin(), node.vChildren.end(), first,
+            [](const unique_ptr<stNode> & child, char character) { return (unsigned char)child->label[0] < (unsigned char)character; });
+    }
+
+    static stNode * _findChild(const stNode & node, char first)
+    {
+        auto it = _lowerBound(const_cast<stNode &>(node), first);
+        return (it != node.vChildren.end() && (*it)->label[0] == first) ? it->get() : nullptr;
+    }
+
+    static size_t _commonPrefixLength(string_view a, string_view b)
+    {
+        size_t length = 0;
+        while (length < a.size() && length < b.size() && a[length] == b[length])
+            length++;
+        return length;
+    }
+
+    /**
+     * @brief Folds the only child of a non-key node into it.
+     */
+    static void _mergeWithOnlyChild(stNode & node)
+    {
+        unique_ptr<stNode> child = move(node.vChildren[0]);
+
+        node.label += child->label;
+        node.isKey = child->isKey;
+        node.vChildren = move(child->vChildren);
+    }
+
+    /**
+     * @brief Finds the node under which every key starting with `prefix` lives.
+     *
+     * @param path Receives the characters from the root to the returned node (a superset of the prefix).
+     * @return The node, or nullptr if no key starts with the prefix.
+     */
+    const stNode * _findPrefixNode(string_view prefix, string & path) const
+    {
+        const stNode * node = &_root;
+
+        while (!prefix.empty())
+        {
+            const stNode * child = _findChild(*node, prefix[0]);
+            if (child == nullptr) return nullptr;
+
+            size_t common = _commonPrefixLength(child->label, prefix);
+            if (common < prefix.size() && common < child->label.size()) return nullptr;
+
+            path += child->label;
+            prefix.remove_prefix(common);
+            node = child;
+        }
+        return node;
+    }
+
+    static void _collect(const stNode & node, string & path, size_t limit, vector <string> & vKeys)
+    {
+        if (node.isKey)
+            vKeys.push_back(path);
+
+        for (const unique_ptr<stNode> & child : node.vChildren)
+        {
+            if (vKeys.size() >= limit) return;
+
+            path += child->label;
+            _collect(*child, path, limit, vKeys);
+            path.resize(path.size() - child->label.size());
+        }
+    }
+
+public:
+    clsRadixTree() = default;
+    clsRadixTree(const clsRadixTree &) = delete;
+    clsRadixTree & operator=(const clsRadixTree &) = delete;
+
+    bool contains(string_view key) const
+    {
+        const stNode * node = &_root;
+
+        while (!key.empty())
+        {
+            const stNode * child = _findChild(*node, key[0]);
+            if (child == nullptr || key.substr(0, child->label.size()) != child->label) return false;
+
+            key.remove_prefix(child->label.size());
+            node = child;
+        }
+        return node->isKey;
+    }
+
+    /**
+     * @return false if the key was already in the tree.
+     */
+    bool insert(string_view key)
+    {
+        if (contains(key)) return false;
+
+        stNode * node = &_root;
+        node->keyCount++;
+
+        while (!key.empty())
+        {
+            auto it = _lowerBound(*node, key[0]);
+
+            if (it == node->vChildren.end() || (*it)->label[0] != key[0])
+            {
+                unique_ptr<stNode> leaf(new stNode);
+                leaf->label = string(key);
+                leaf->isKey = true;
+                leaf->keyCount = 1;
+                node->vChildren.insert(it, move(leaf));
+                return true;
+            }
+
+            size_t common = _commonPrefixLength((*it)->label, key);
+
+            // the key leaves the child's label half-way: split the label at that point.
+            if (common < (*it)->label.size())
+            {
+                unique_ptr<stNode> middle(new stNode);
+                middle->label = (*it)->label.substr(0, common);
+                middle->keyCount = (*it)->keyCount;
+
+                (*it)->label.erase(0, common);
+                middle->vChildren.push_back(move(*it));
+                *it = move(middle);
+            }
+
+            node = it->get();
+            node->keyCount++;
+            key.remove_prefix(common);
+        }
+
+        node->isKey = true;
+        return true;
+    }
+
+    /**
+     * @return false if the key was not in the tree.
+     */
+    bool erase(string_view key)
+    {
+        if (!contains(key)) return false;
+
+        vector <stNode *> vPath = {&_root};
+
+        while (!key.empty())
+        {
+            stNode * child = _findChild(*vPath.back(), key[0]);
+            key.remove_prefix(child->label.size());
+            vPath.push_back(child);
+        }
+
+        for (stNode * node : vPath)
+            node->keyCount--;
+
+        stNode * node = vPath.back();
+        node->isKey = false;
+
+        if (vPath.size() == 1) return true;
+
+        stNode * parent = vPath[vPath.size() - 2];
+
+        if (node->vChildren.empty())
+        {
+            parent->vChildren.erase(_lowerBound(*parent, node->label[0]));
+
+            if (parent != &_root && !parent->isKey && parent->vChildren.size() == 1)
+                _mergeWithOnlyChild(*parent);
+        }
+        else if (node->vChildren.size() == 1)
+            _mergeWithOnlyChild(*node);
+
+        return true;
+    }
+
+    void clear()
+    {
+        _root.vChildren.clear();
+        _root.isKey = false;
+        _root.keyCount = 0;
+    }
+
+    size_t size() const
+    {
+        return _root.keyCount;
+    }
+
+    /**
+     * @brief Counts the keys that start with a prefix.
+     */
+    size_t countWithPrefix(string_view prefix) const
+    {
+        string path;
+        const stNode * node = _findPrefixNode(prefix, path);
+        return node == nullptr ? 0 : node->keyCount;
+    }
+
+    /**
+     * @brief Lists the keys that start with a prefix, in lexicographic order.
+     *
+     * @param prefix The prefix; an empty prefix lists every key.
+     * @param limit The number of keys to return at most.
+     */
+    vector <string> withPrefix(string_view prefix, size_t limit) const
+    {
+        vector <string> vKeys;
+        string path;
+
+        const stNode * node = _findPrefixNode(prefix, path);
+        if (node != nullptr && limit > 0)
+            _collect(*node, path, limit, vKeys);
+
+        return vKeys;
+    }
+};
@@ -0,0 +1,138 @@
+/**
+ * @file clsShardedIndex.h
+ * @brief Declares the `clsShardedIndex` class template, a key → position index split into independent shards.
+ *
+ * ## Overview
+ * A single hash map has to be filled one key at a time. Splitting the keys over 64 shards by
+ * hash lets `build()` fill every shard on its own worker, so building the index of a large data
+ * file scales with the number of cores like the parsing does. Lookups only touch one shard.
+ *
+ * ## Notable Implementation Details
+ * - The key type is a template parameter (default `string`) hashed through `std::hash`; the client
+ *   repository indexes `clsAccountKey`s, so its shards hold 8-byte keys instead of strings.
+ * - The shard is picked from the *high* bits of the mixed key hash, leaving the low bits to the
+ *   shard's own hash map (implementations that use power-of-two bucket counts would otherwise put
+ *   every key of a shard into the same few buckets).
+ * - `build()` runs in two passes: the positions are first sorted into per-chunk, per-shard lists
+ *   (parallel over chunks), then every shard is filled from its lists (parallel over shards).
+ *   Positions are inserted in ascending order, so a duplicated key points at its last record.
+ * - Small indexes (under 16K keys) are built on the calling thread: queuing 64 shard tasks would
+ *   cost more than the inserts.
+ */
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include "clsThreadPool.h"
+using namespace std;
+
+template <typename KeyType = string>
+class clsShardedIndex
+{
+private:
+    static const int _shardBits = 6;
+    static const size_t _shardCount = size_t(1) << _shardBits;
+    static const size_t _minKeysPerChunk = 16 * 1024;
+
+    vector <unordered_map <KeyType, size_t>> _vShards = vector <unordered_map <KeyType, size_t>>(_shardCount);
+
+    static size_t _shardOf(const KeyType & key)
+    {
+        uint64_t hash = uint64_t(std::hash<KeyType>()(key)) * 0x9E3779B97F4A7C15ULL;
+        return size_t(hash >> (64 - _shardBits));
+    }
+
+public:
+    /**
+     * @return The position stored for the key, or `nullptr` if the key is not indexed.
+     */
+    const size_t * find(const KeyType & key) const
+    {
+        const unordered_map <KeyType, size_t> & shard = _vShards[_shardOf(key)];
+
+        auto it = shard.find(key);
+        return it == shard.end() ? nullptr : &it->second;
+    }
+
+    bool contains(const KeyType & key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    void set(const KeyType & key, size_t position)
+    {
+        _vShards[_shardOf(key)][key] = position;
+    }
+
+    void erase(const KeyType & key)
+    {
+        _vShards[_shardOf(key)].erase(key);
+    }
+
+    void clear()
+    {
+        for (unordered_map <KeyType, size_t> & shard : _vShards)
+            shard.clear();
+    }
+
+    size_t size() const
+    {
+        size_t count = 0;
+
+        for (const unordered_map <KeyType, size_t> & shard : _vShards)
+            count += shard.size();
+        return count;
+    }
+
+    /**
+     * @brief Replaces the index with the keys of positions `[0, count)`.
+     *
+     * @param keyOf Returns the key stored at a position; called from several workers at once.
+     */
+    void build(size_t count, const function<KeyType(size_t)> & keyOf, clsThreadPool & pool)
+    {
+        if (count < _minKeysPerChunk)
+        {
+            clear();
+            for (size_t position = 0; position < count; position++)
+                set(keyOf(position), position);
+            return;
+        }
+
+        size_t chunkCount = min(pool.getThreadCount() * 4, max<size_t>(1, count / _minKeysPerChunk));
+
+        // 1. sort the positions of every chunk by shard.
+        vector <vector <vector <size_t>>> vChunkShards(chunkCount, vector <vector <size_t>>(_shardCount));
+
+        pool.parallelFor(chunkCount, [&](size_t chunk)
+        {
+            size_t begin = count * chunk / chunkCount, end = count * (chunk + 1) / chunkCount;
+
+            for (size_t position = begin; position < end; position++)
+                vChunkShards[chunk][_shardOf(keyOf(position))].push_back(position);
+        });
+
+        // 2. fill every shard from its lists, chunk by chunk.
+        pool.parallelFor(_shardCount, [&](size_t shardNumber)
+        {
+            unordered_map <KeyType, size_t> & shard = _vShards[shardNumber];
+            size_t shardSize = 0;
+
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+                shardSize += vChunkShards[chunk][shardNumber].size();
+
+            shard.clear();
+            shard.reserve(shardSize);
+
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+            {
+                for (size_t position : vChunkShards[chunk][shardNumber])
+                    shard[keyOf(position)] = position;
+            }
+        });
+    }
+};
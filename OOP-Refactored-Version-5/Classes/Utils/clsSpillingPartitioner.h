@@ -0,0 +1,209 @@
+/**
+ * @file clsSpillingPartitioner.h
+ * @brief Declares the `clsSpillingPartitioner` class, which groups text lines by key under a fixed memory budget.
+ *
+ * ## Overview
+ * Grouping a large log by account usually means loading it whole and sorting it. The partitioner
+ * instead hashes the key of every line into one of `P` partitions as the lines stream in, so every
+ * line of a given key lands in the same partition. When the buffered lines outgrow the memory
+ * budget, every partition buffer is appended to its own spill file and emptied. Afterwards each
+ * partition is taken back on its own (its spill file followed by what is still buffered), small
+ * enough to be grouped in memory, and different partitions can be processed in parallel.
+ *
+ * ## Usage
+ * ```cpp
+ * clsSpillingPartitioner partitioner("Statements/.spill", 64, 32 * 1024 * 1024);
+ * partitioner.add("A101", "A101#//#...");
+ * string lines = partitioner.takePartition(3);   // every line added to partition 3, in order
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - Lines keep the order they were added in within a partition, so a stable sort by key keeps
+ *   the records of every key in their original order.
+ * - A spill appends every non-empty buffer to its file with one write; the files are opened and
+ *   closed per spill, so the number of partitions is not bounded by the open file limit.
+ * - `choosePartitionCount()` sizes the partitions so that one worker per thread can hold its
+ *   partition in memory at once without exceeding the budget.
+ * - The spill files (and the spill folder, when left empty) are removed by the destructor.
+ * - `add()` must be called from one thread; distinct partitions can then be taken concurrently.
+ */
+#pragma once
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <filesystem>
+#include <functional>
+#include <stdexcept>
+#include <cstdint>
+using namespace std;
+
+class clsSpillingPartitioner
+{
+private:
+    string _spillFolder;
+    size_t _memoryBudget;
+    vector <string> _vBuffers;
+    vector <char> _vHasSpillFile;    // not vector<bool>: partitions are taken from several threads.
+    size_t _bufferedBytes = 0;
+    uint64_t _spilledBytes = 0;
+    size_t _spillCount = 0;
+
+    string _spillFileName(size_t partition) const
+    {
+        return _spillFolder + "/partition-" + to_string(partition) + ".spill";
+    }
+
+public:
+    clsSpillingPartitioner(const string& spillFolder, size_t partitionCount, size_t memoryBudget)
+        : _spillFolder(spillFolder), _memoryBudget(memoryBudget),
+          _vBuffers(max<size_t>(1, partitionCount)), _vHasSpillFile(max<size_t>(1, partitionCount), 0)
+    {
+    }
+
+    clsSpillingPartitioner(const clsSpillingPartitioner &) = delete;
+    clsSpillingPartitioner & operator=(const clsSpillingPartitioner &) = delete;
+
+    ~clsSpillingPartitioner()
+    {
+        error_code error;
+
+        for (size_t partition = 0; partition < _vHasSpillFile.size(); partition++)
+        {
+            if (_vHasSpillFile[partition])
+                filesystem::remove(_spillFileName(partition), error);
+        }
+
+        // only removed when empty: the folder may hold files that are not ours.
+        filesystem::remove(_spillFolder, error);
+    }
+
+    /**
+     * @brief Returns the number of partitions that keeps `workers` partitions within `memoryBudget`.
+     *
+     * @param expectedBytes An estimate of the total size of the lines that will be added.
+     */
+    static size_t choosePartitionCount(uint64_t expectedBytes, size_t memoryBudget, size_t workers)
+    {
+        uint64_t partitionBytes = max<uint64_t>(1, memoryBudget / max<size_t>(1, workers));
+        uint64_t partitionCount = (expectedBytes + partitionBytes - 1) / partitionBytes;
+
+        return (size_t)min<uint64_t>(4096, max<uint64_t>(workers, partitionCount));
+    }
+
+    /**
+     * @brief Returns the partition a key belongs to.
+     */
+    size_t partitionOf(string_view key) const
+    {
+        return hash<string_view>()(key) % _vBuffers.size();
+    }
+
+    /**
+     * @brief Adds a line (without its new line) to the partition of `key`; spills when over budget.
+     */
+    void add(string_view key, string_view line)
+    {
+        string & buffer = _vBuffers[partitionOf(key)];
+
+        buffer.append(line);
+        buffer += '\n';
+        _bufferedBytes += line.size() + 1;
+
+        if (_bufferedBytes > _memoryBudget)
+            spill();
+    }
+
+    /**
+     * @brief Appends every partition buffer to its spill file and releases the buffers.
+     *
+     * @throws runtime_error When a spill file cannot be written.
+     */
+    void spill()
+    {
+        if (_bufferedBytes == 0) return;
+
+        error_code error;
+        filesystem::create_directories(_spillFolder, error);
+
+        for (size_t partition = 0; partition < _vBuffers.size(); partition++)
+        {
+            string & buffer = _vBuffers[partition];
+            if (buffer.empty()) continue;
+
+            fstream spillFile;
+            spillFile.open(_spillFileName(partition), ios::out | ios::app | ios::binary);
+            spillFile.write(buffer.data(), buffer.size());
+            spillFile.close();
+
+            if (spillFile.fail())
+                throw runtime_error("Could not write the spill file [" + _spillFileName(partition) + "]");
+
+            _vHasSpillFile[partition] = 1;
+            _spilledBytes += buffer.size();
+
+            string().swap(buffer);
+        }
+
+        _bufferedBytes = 0;
+        _spillCount++;
+    }
+
+    /**
+     * @brief Returns every line of a partition in the order they were added, and forgets them.
+     *
+     * @throws runtime_error When the spill file of the partition cannot be read back.
+     */
+    string takePartition(size_t partition)
+    {
+        string lines;
+
+        if (_vHasSpillFile[partition])
+        {
+            string fileName = _spillFileName(partition);
+            error_code error;
+            uintmax_t fileSize = filesystem::file_size(fileName, error);
+
+            fstream spillFile;
+            spillFile.open(fileName, ios::in | ios::binary);
+
+            if (error || !spillFile.is_open())
+                throw runtime_error("Could not read the spill file [" + fileName + "]");
+
+            lines.resize((size_t)fileSize);
+            spillFile.read(&lines[0], fileSize);
+            lines.resize(spillFile.gcount());
+            spillFile.close();
+
+            filesystem::remove(fileName, error);
+            _vHasSpillFile[partition] = 0;
+        }
+
+        lines += _vBuffers[partition];
+        string().swap(_vBuffers[partition]);
+
+        return lines;
+    }
+
+    size_t getPartitionCount() const
+    {
+        return _vBuffers.size();
+    }
+
+    /**
+     * @brief Returns the number of bytes written to the spill files so far.
+     */
+    uint64_t getSpilledBytes() const
+    {
+        return _spilledBytes;
+    }
+
+    /**
+     * @brief Returns the number of times the buffers were spilled.
+     */
+    size_t getSpillCount() const
+    {
+        return _spillCount;
+    }
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <iostream>
 #include <vector>
+#include <string_view>
+#include <charconv>
 using namespace std;
 
 class clsString
@@ -236,6 +238,40 @@ public:
         if (s != "") vWords.push_back(s);
     }
 
+    // like split(), but the words are views into `s` (no copies); stops after `maxWords` words.
+    static size_t splitView(string_view s, string_view * arWords, size_t maxWords, string_view divider = " ")
+    {
+        size_t count = 0, pos = 0;
+
+        while (count < maxWords && (pos = s.find(divider)) != s.npos)
+        {
+            if (pos != 0) arWords[count++] = s.substr(0, pos);
+            s.remove_prefix(pos + divider.length());
+        }
+
+        if (count < maxWords && !s.empty()) arWords[count++] = s;
+
+        return count;
+    }
+
+    // a number at the start of `s` (0 if there is none), without copying it into a string first.
+    static double parseDouble(string_view s)
+    {
+        double value = 0;
+        from_chars(s.data(), s.data() + s.size(), value);
+        return value;
+    }
+
+    // appends a number exactly as to_string() writes it (six decimals), without going through printf.
+    static void appendFixed(string & out, double value)
+    {
+        char buffer[384];
+        to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), value, chars_format::fixed, 6);
+
+        if (result.ec == errc()) out.append(buffer, result.ptr);
+        else out += to_string(value);
+    }
+
     void split(vector <string> &vWords, string divider = " ")
     {
         split(_value, vWords);
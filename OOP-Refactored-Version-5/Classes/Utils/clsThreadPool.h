@@ -0,0 +1,144 @@
+/**
+ * @file clsThreadPool.h
+ * @brief Declares the `clsThreadPool` class, a fixed set of worker threads running queued tasks.
+ *
+ * ## Overview
+ * Starting a thread costs far more than parsing a few thousand records, so CPU-bound work that is
+ * split into pieces (loading a large data file, building its index) is handed to a pool of
+ * long-lived workers instead. `parallelFor()` covers the common case: run `task(i)` for every
+ * piece and wait for all of them.
+ *
+ * ## Usage
+ * ```cpp
+ * clsThreadPool::shared().parallelFor(vChunks.size(), [&](size_t i) { _parseChunk(vChunks[i]); });
+ * ```
+ *
+ * ## Notable Implementation Details
+ * - `shared()` is sized to the number of hardware threads and lives until the program ends.
+ * - The calling thread blocks in `parallelFor()`; a task must not call `parallelFor()` on the
+ *   pool running it (the workers could all end up waiting on each other).
+ * - An exception thrown by a task is rethrown by `parallelFor()` once every piece has finished.
+ */
+#pragma once
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <algorithm>
+using namespace std;
+
+class clsThreadPool
+{
+private:
+    vector <thread> _vWorkers;
+    queue <packaged_task<void()>> _qTasks;
+    mutex _lock;
+    condition_variable _wake;
+    bool _stopping = false;
+
+    void _workerLoop()
+    {
+        while (true)
+        {
+            packaged_task<void()> task;
+            {
+                unique_lock <mutex> guard(_lock);
+                _wake.wait(guard, [this]() { return _stopping || !_qTasks.empty(); });
+
+                if (_qTasks.empty()) return;
+
+                task = move(_qTasks.front());
+                _qTasks.pop();
+            }
+            task();
+        }
+    }
+
+public:
+    /**
+     * @brief Starts the given number of workers (at least one).
+     */
+    explicit clsThreadPool(size_t threadCount)
+    {
+        threadCount = max<size_t>(1, threadCount);
+
+        for (size_t i = 0; i < threadCount; i++)
+            _vWorkers.emplace_back(&clsThreadPool::_workerLoop, this);
+    }
+
+    /**
+     * @brief Finishes the queued tasks, then stops the workers.
+     */
+    ~clsThreadPool()
+    {
+        {
+            lock_guard <mutex> guard(_lock);
+            _stopping = true;
+        }
+        _wake.notify_all();
+
+        for (thread & worker : _vWorkers)
+            worker.join();
+    }
+
+    clsThreadPool(const clsThreadPool &) = delete;
+    clsThreadPool & operator=(const clsThreadPool &) = delete;
+
+    size_t getThreadCount() const
+    {
+        return _vWorkers.size();
+    }
+
+    /**
+     * @brief Queues one task.
+     * @return A future that becomes ready (or holds the task's exception) once the task has run.
+     */
+    future<void> submit(function<void()> task)
+    {
+        packaged_task<void()> packagedTask(move(task));
+        future<void> result = packagedTask.get_future();
+        {
+            lock_guard <mutex> guard(_lock);
+            _qTasks.push(move(packagedTask));
+        }
+        _wake.notify_one();
+        return result;
+    }
+
+    /**
+     * @brief Runs `task(i)` for every `i` in `[0, count)` on the workers and waits for all of them.
+     */
+    void parallelFor(size_t count, const function<void(size_t)> & task)
+    {
+        if (count == 1)
+        {
+            task(0);
+            return;
+        }
+
+        vector <future<void>> vResults;
+        vResults.reserve(count);
+
+        for (size_t i = 0; i < count; i++)
+            vResults.push_back(submit([&task, i]() { task(i); }));
+
+        for (future<void> & result : vResults)
+            result.wait();
+
+        for (future<void> & result : vResults)
+            result.get();
+    }
+
+    /**
+     * @brief The process-wide pool, one worker per hardware thread.
+     */
+    static clsThreadPool & shared()
+    {
+        static clsThreadPool pool(thread::hardware_concurrency());
+        return pool;
+    }
+};
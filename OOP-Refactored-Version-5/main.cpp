@@ -1,8 +1,76 @@
 #include <iostream>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <cstdlib>
 #include "Classes/Screens/Login/clsLoginScreen.h"
+#include "Classes/Tools/clsSessionReplayer.h"
+#include "Classes/Tools/clsLoadBenchmark.h"
+#include "Classes/Tools/clsAllocationCheck.h"
+#include "Classes/Tools/clsSortBenchmark.h"
+#include "Classes/Tools/clsRepositoryCheck.h"
+#include "Classes/Utils/clsMetrics.h"
+#include "Classes/Utils/clsTracer.h"
 using namespace std;
 
-int main()
+int main(int argc, char* argv[])
 {
-    clsLoginScreen::showLogInScreen();      
+    // BANK_SYNC=commit flushes every commit and add to the disk before it returns; the replayed sessions inherit it.
+    const char * syncPolicy = getenv("BANK_SYNC");
+    if (syncPolicy != nullptr && string(syncPolicy) == "commit")
+        DataSyncPolicy = enSyncPolicy::SyncOnCommit;
+    else if (syncPolicy != nullptr && *syncPolicy != '\0' && string(syncPolicy) != "none")
+        cerr << "Unknown BANK_SYNC value [" << syncPolicy << "], expected commit or none: not syncing." << endl;
+
+    // headless load test: app --replay [scripts folder] [sessions] [workers]
+    if (argc > 1 && string(argv[1]) == "--replay")
+    {
+        return clsSessionReplayer::replay(argv[0], argc > 2 ? argv[2] : ReplayScriptsFolder, argc > 3 ? stoi(argv[3]) : 100,
+                                          argc > 4 ? stoi(argv[4]) : max(1, (int)thread::hardware_concurrency()));
+    }
+
+    // one session of the load test, started by --replay: app --replay-session <script>
+    if (argc > 2 && string(argv[1]) == "--replay-session")
+    {
+        return clsSessionReplayer::replaySession(argv[2]);
+    }
+
+    // loader scaling benchmark: app --bench-load [rows]
+    if (argc > 1 && string(argv[1]) == "--bench-load")
+    {
+        return clsLoadBenchmark::run(argc > 2 ? stoi(argv[2]) : 1000000);
+    }
+
+    // external sort benchmark of the transfer log: app --bench-sort [megabytes] [budget megabytes] [folder]
+    if (argc > 1 && string(argv[1]) == "--bench-sort")
+    {
+        return clsSortBenchmark::run(argc > 2 ? stoull(argv[2]) : 1024, argc > 3 ? stoul(argv[3]) : 256, argc > 4 ? argv[4] : "");
+    }
+
+    // heap allocations of one find-and-print: app --check-allocs [account number]
+    if (argc > 1 && string(argv[1]) == "--check-allocs")
+    {
+        return clsAllocationCheck::run(argc > 2 ? argv[2] : "A101");
+    }
+
+    // the repository against outside changes of its files and under both sync policies: app --check-repository
+    if (argc > 1 && string(argv[1]) == "--check-repository")
+    {
+        return clsRepositoryCheck::run();
+    }
+
+    // save the metrics and the trace however the program ends (after the last session, on a load error, or on exit()).
+    clsMetrics::dumpToFileAtExit(MetricsFile);
+    clsTracer::exportAtExitIfEnabled();
+
+    try
+    {
+        clsLoginScreen::showLogInScreen();
+    }
+    catch (const length_error & e)
+    {
+        // a data file holding a field too long to store (see clsFixedString): refuse to run on it.
+        cerr << "\nCannot load the data files: " << e.what() << endl;
+        return 1;
+    }
 }